@@ -5,6 +5,8 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
 #include "DrawDebugHelpers.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+#include "Subsystem/WS_Perception2D.h"
 
 UBTS_LOS2D::UBTS_LOS2D()
 {
@@ -12,8 +14,10 @@ UBTS_LOS2D::UBTS_LOS2D()
 	Interval = 0.15f; RandomDeviation = 0.05f; // 6–8 Hz
 }
 
-void UBTS_LOS2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*, float)
+void UBTS_LOS2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds); // schedules the next run
+
 	auto* BB = OwnerComp.GetBlackboardComponent();
 	auto* AIC = OwnerComp.GetAIOwner();
 	if (!BB || !AIC) return;
@@ -23,11 +27,31 @@ void UBTS_LOS2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8*, float)
 	if (!Me || !T) { BB->SetValueAsBool(HasLOSKey.SelectedKeyName, false); return; }
 
 	float Dist = 0.f;
-	const bool bLOS = HasLOS_2D(Me, T, EyeHeight, SightRange, LOSChannel, Dist);
+	bool bLOS = false;
+	UWS_Perception2D* Perception = UWS_Perception2D::Get(Me);
+	if (Perception && T == Perception->GetPlayerPawn())
+	{
+		// batched trace; BB keeps its last value until this pawn's first result lands
+		if (!Perception->QueryPlayerLOS(Me, EyeHeight, SightRange, LOSChannel, bLOS, Dist)) return;
+	}
+	else
+	{
+		bLOS = HasLOS_2D(Me, T, EyeHeight, SightRange, LOSChannel, Dist);
+	}
 	BB->SetValueAsBool(HasLOSKey.SelectedKeyName, bLOS);
 	if (DistKey.SelectedKeyName.IsNone() == false) BB->SetValueAsFloat(DistKey.SelectedKeyName, Dist);
 }
 
+void UBTS_LOS2D::ScheduleNextTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	// off-screen enemies (UWS_EnemyLOD) check LOS less often
+	const AAIController* AIC = OwnerComp.GetAIOwner();
+	const ACPP_EnemyParent* E = AIC ? Cast<ACPP_EnemyParent>(AIC->GetPawn()) : nullptr;
+	const float Scale = E ? E->GetAISenseScale() : 1.f;
+
+	SetNextTickTime(NodeMemory, FMath::FRandRange(FMath::Max(0.f, Interval - RandomDeviation), Interval + RandomDeviation) * Scale);
+}
+
 bool UBTS_LOS2D::HasLOS_2D(const APawn* Me, const AActor* Target, float EyeZ, float Range, ECollisionChannel Chan, float& OutDist)
 {
 	const FVector M = Me->GetActorLocation();
@@ -4,6 +4,8 @@
 #include "AI/BTService/BTS_SenseVertical2D.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+#include "Subsystem/WS_Perception2D.h"
 
 UBTS_SenseVertical2D::UBTS_SenseVertical2D()
 {
@@ -12,8 +14,10 @@ UBTS_SenseVertical2D::UBTS_SenseVertical2D()
 	RandomDeviation = 0.05f;
 }
 
-void UBTS_SenseVertical2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float)
+void UBTS_SenseVertical2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds); // schedules the next run
+
 	auto* BB = OwnerComp.GetBlackboardComponent();
 	auto* AIC = OwnerComp.GetAIOwner();
 	if (!BB || !AIC) return;
@@ -23,7 +27,10 @@ void UBTS_SenseVertical2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* No
 	if (!Me || !Target) return;
 
 	const FVector M = Me->GetActorLocation();
-	const FVector T = Target->GetActorLocation();
+	const UWS_Perception2D* Perception = UWS_Perception2D::Get(Me);
+	const FVector T = (Perception && Target == Perception->GetPlayerPawn())
+		? Perception->GetPlayerLocation()
+		: Target->GetActorLocation();
 
 	const float dz = T.Z - M.Z;
 	const float dx = FMath::Abs(T.X - M.X);
@@ -32,6 +39,12 @@ void UBTS_SenseVertical2D::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* No
 	BB->SetValueAsBool(PlayerAboveKey.SelectedKeyName, bAbove);
 }
 
+void UBTS_SenseVertical2D::ScheduleNextTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	// same cadence, stretched by the pawn's tick LOD
+	const AAIController* AIC = OwnerComp.GetAIOwner();
+	const ACPP_EnemyParent* E = AIC ? Cast<ACPP_EnemyParent>(AIC->GetPawn()) : nullptr;
+	const float Scale = E ? E->GetAISenseScale() : 1.f;
 
-
-
+	SetNextTickTime(NodeMemory, FMath::FRandRange(FMath::Max(0.f, Interval - RandomDeviation), Interval + RandomDeviation) * Scale);
+}
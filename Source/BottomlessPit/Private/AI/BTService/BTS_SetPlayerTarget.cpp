@@ -4,11 +4,18 @@
 #include "AI/BTService/BTS_SetPlayerTarget.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Subsystem/WS_Perception2D.h"
 
-void UBTS_SetPlayerTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float)
+void UBTS_SetPlayerTarget::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
+    Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds); // schedules the next run
+
+    // player pawn is resolved once per frame by the perception subsystem
+    const UWS_Perception2D* Perception = UWS_Perception2D::Get(OwnerComp.GetWorld());
+    APawn* P = Perception ? Perception->GetPlayerPawn() : UGameplayStatics::GetPlayerPawn(OwnerComp.GetWorld(), 0);
+
     if (auto* BB = OwnerComp.GetBlackboardComponent())
-        if (APawn* P = UGameplayStatics::GetPlayerPawn(OwnerComp.GetWorld(), 0))
+        if (P)
             BB->SetValueAsObject(TargetKey.SelectedKeyName, P);
 }
 
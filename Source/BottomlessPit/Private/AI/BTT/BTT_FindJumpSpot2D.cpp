@@ -6,6 +6,7 @@
 #include "AIController.h"
 #include "Components/CapsuleComponent.h"
 #include "DrawDebugHelpers.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
 
 UBTT_FindJumpSpot2D::UBTT_FindJumpSpot2D()
 {
@@ -26,6 +27,14 @@ EBTNodeResult::Type UBTT_FindJumpSpot2D::ExecuteTask(UBehaviorTreeComponent& Own
 
 	const FVector Origin = Me->GetActorLocation();
 
+	// Capsule size (fallback guess for pawns without one)
+	float Radius = 18.f, HalfHeight = 44.f;
+	if (const UCapsuleComponent* Cap = Me->FindComponentByClass<UCapsuleComponent>())
+	{
+		Radius = Cap->GetScaledCapsuleRadius();
+		HalfHeight = Cap->GetScaledCapsuleHalfHeight();
+	}
+
 	// Estimate needed headroom from target height difference
 	AActor* Target = Cast<AActor>(BB->GetValueAsObject(TargetKey.SelectedKeyName));
 	float NeedHeadroom = RequiredHeadroom;
@@ -35,10 +44,38 @@ EBTNodeResult::Type UBTT_FindJumpSpot2D::ExecuteTask(UBehaviorTreeComponent& Own
 		NeedHeadroom = FMath::Max(RequiredHeadroom, dz + 50.f); // enough to reach target ledge
 	}
 
-	// Try right, then left
+	// Platform graph: stand under a linked ledge toward the target if one is in reach
+	// (JumpUp2D rises through strips, so only the room below that ledge has to be clear)
 	FVector Spot;
-	const bool bRight = FindCandidate(W, Origin, +1.f, Spot, NeedHeadroom);
-	const bool bLeft = bRight ? false : FindCandidate(W, Origin, -1.f, Spot, NeedHeadroom);
+	const UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(W);
+	const int32 Here = (Graph && Graph->HasData()) ? Graph->FindSpanBelow(Origin + FVector(0, 0, 50), GroundTrace) : INDEX_NONE;
+	if (Here != INDEX_NONE)
+	{
+		// JumpUp2D: v0 = sqrt(2 g h) capped at MaxJumpSpeed, and it aims 60 above the ledge
+		const float G = FMath::Max(JumpGravity, 1.f);
+		const float MaxRise = FMath::Square(MaxJumpSpeed) / (2.f * G) - 60.f;
+
+		const float PreferX = Target ? Target->GetActorLocation().X : Origin.X;
+		float TakeoffX = Origin.X;
+		const int32 Ledge = Graph->FindJumpUp(Here, PreferX, MaxRise, TakeoffX);
+
+		FPlatformSpan2D From, To;
+		if (Graph->GetSpan(Here, From) && Graph->GetSpan(Ledge, To)
+			&& FMath::Abs(TakeoffX - Origin.X) <= MaxSearchDistance)
+		{
+			const FVector Ground(TakeoffX, Origin.Y, From.TopZ);
+			if (Graph->IsHeadroomClear(TakeoffX, Radius, From.TopZ + TopMargin, To.BottomZ - From.TopZ - TopMargin - 1.f))
+			{
+				BB->SetValueAsVector(JumpSpotKey.SelectedKeyName, Ground);
+				BB->SetValueAsBool(HasJumpSpotKey.SelectedKeyName, true);
+				return EBTNodeResult::Succeeded;
+			}
+		}
+	}
+
+	// Try right, then left
+	const bool bRight = FindCandidate(W, Origin, +1.f, Spot, NeedHeadroom, Radius, HalfHeight);
+	const bool bLeft = bRight ? false : FindCandidate(W, Origin, -1.f, Spot, NeedHeadroom, Radius, HalfHeight);
 
 	if (bRight || bLeft)
 	{
@@ -50,16 +87,18 @@ EBTNodeResult::Type UBTT_FindJumpSpot2D::ExecuteTask(UBehaviorTreeComponent& Own
 	return EBTNodeResult::Failed;
 }
 
-bool UBTT_FindJumpSpot2D::FindCandidate(UWorld* W, const FVector& Origin, const float DirSign, FVector& OutSpot, float NeedHeadroomZ) const
+bool UBTT_FindJumpSpot2D::FindCandidate(UWorld* W, const FVector& Origin, const float DirSign, FVector& OutSpot, float NeedHeadroomZ,
+	float Radius, float HalfHeight) const
 {
 	for (float d = Step; d <= MaxSearchDistance; d += Step)
 	{
 		FVector Test = Origin + FVector(DirSign * d, 0.f, 0.f);
 
 		FVector Ground;
-		if (!GroundAt(W, Test, Ground)) continue;
+		bool bFromGraph = false;
+		if (!GroundAt(W, Test, Ground, bFromGraph)) continue;
 
-		if (HeadroomClear(W, Ground, NeedHeadroomZ))
+		if (HeadroomClear(W, Ground, NeedHeadroomZ, Radius, HalfHeight, bFromGraph))
 		{
 			OutSpot = Ground;
 			return true;
@@ -68,9 +107,15 @@ bool UBTT_FindJumpSpot2D::FindCandidate(UWorld* W, const FVector& Origin, const
 	return false;
 }
 
-bool UBTT_FindJumpSpot2D::GroundAt(UWorld* W, const FVector& From, FVector& OutGround) const
+bool UBTT_FindJumpSpot2D::GroundAt(UWorld* W, const FVector& From, FVector& OutGround, bool& bOutFromGraph) const
 {
 	const FVector Start = From + FVector(0, 0, 50);
+
+	// graph knows the generator's strip spans; anything else (no generator, hand-placed geometry) is traced
+	const UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(W);
+	bOutFromGraph = Graph && Graph->HasData() && Graph->GroundBelow(Start, GroundTrace, OutGround);
+	if (bOutFromGraph) return true;
+
 	const FVector End = Start + FVector(0, 0, -GroundTrace);
 
 	FCollisionQueryParams P(SCENE_QUERY_STAT(JumpSpot_Ground), false);
@@ -83,10 +128,15 @@ bool UBTT_FindJumpSpot2D::GroundAt(UWorld* W, const FVector& From, FVector& OutG
 	return false;
 }
 
-bool UBTT_FindJumpSpot2D::HeadroomClear(UWorld* W, const FVector& GroundLoc, float Height) const
+bool UBTT_FindJumpSpot2D::HeadroomClear(UWorld* W, const FVector& GroundLoc, float Height, float Radius, float HalfHeight, bool bUseGraph) const
 {
-	// Capsule size guess (if your pawn has a capsule, read it)
-	float Radius = 18.f, HalfHeight = 44.f;
+	// Same volume as the sweep below, checked against the graph's span bodies
+	const UWS_PlatformGraph2D* Graph = bUseGraph ? UWS_PlatformGraph2D::Get(W) : nullptr;
+	if (Graph)
+	{
+		return Graph->IsHeadroomClear(GroundLoc.X, Radius, GroundLoc.Z + TopMargin, 2.f * HalfHeight + Height);
+	}
+
 	// We use a simple vertical capsule sweep to check ceiling clearance
 	const FVector Start = GroundLoc + FVector(0, 0, HalfHeight + TopMargin);
 	const FVector End = Start + FVector(0, 0, Height);
@@ -4,6 +4,7 @@
 #include "AI/BTT/BTT_FindVantage2D.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
 
 UBTT_FindVantage2D::UBTT_FindVantage2D() { NodeName = TEXT("Find Vantage (same floor)"); }
 
@@ -78,6 +79,11 @@ bool UBTT_FindVantage2D::GroundAt(UWorld* W, const FVector& FromXZ, FVector& Out
 {
 	const FVector Start = FromXZ + FVector(0, 0, GroundTrace * 0.5f);
 	const FVector End = FromXZ - FVector(0, 0, GroundTrace);
+
+	// graph lookup instead of one trace per probe; trace when the graph has no span there (non-strip ground)
+	const UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(W);
+	if (Graph && Graph->HasData() && Graph->GroundBelow(Start, Start.Z - End.Z, OutGround)) return true;
+
 	FHitResult Hit; FCollisionQueryParams Q(SCENE_QUERY_STAT(Vantage_Ground), false);
 	if (W->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, Q))
 	{
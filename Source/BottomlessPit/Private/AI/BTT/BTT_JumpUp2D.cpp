@@ -6,6 +6,7 @@
 #include "AIController.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Components/CapsuleComponent.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
 
 UBTT_JumpUp2D::UBTT_JumpUp2D()
 {
@@ -83,6 +84,14 @@ bool UBTT_JumpUp2D::IsGrounded(APawn* P) const
 	const FVector Start = Loc + FVector(0, 0, 10);
 	const FVector End = Loc - FVector(0, 0, HalfHeight + 5.f);
 
+	// landing check runs every frame of the jump; the graph answers it without a trace
+	// when it knows the ground, geometry outside the graph still gets traced
+	const UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(P);
+	if (Graph && Graph->HasData() && Graph->FindSpanBelow(Start, Start.Z - End.Z) != INDEX_NONE)
+	{
+		return true;
+	}
+
 	FHitResult Hit;
 	FCollisionQueryParams Q(SCENE_QUERY_STAT(Jump2D_Ground), false, P);
 	return P->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, GroundTraceChannel, Q);
@@ -3,10 +3,8 @@
 #include "AI/BTT/BTT_MaintainDistance2D.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
-#include "GameFramework/FloatingPawnMovement.h"
-#include "Components/CapsuleComponent.h"
-#include "PaperFlipbookComponent.h"
 #include "GameFramework/Actor.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
 
 UBTT_MaintainDistance2D::UBTT_MaintainDistance2D()
 {
@@ -14,33 +12,51 @@ UBTT_MaintainDistance2D::UBTT_MaintainDistance2D()
 	bNotifyTick = true;
 }
 
-EBTNodeResult::Type UBTT_MaintainDistance2D::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8*)
+void UBTT_MaintainDistance2D::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
 {
+	InitializeNodeMemory<FBTMaintainDistance2DMemory>(NodeMemory, InitType);
+}
+
+void UBTT_MaintainDistance2D::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTMaintainDistance2DMemory>(NodeMemory, CleanupType);
+}
+
+EBTNodeResult::Type UBTT_MaintainDistance2D::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	FBTMaintainDistance2DMemory* Mem = CastInstanceNodeMemory<FBTMaintainDistance2DMemory>(NodeMemory);
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
 	AAIController* AIC = OwnerComp.GetAIOwner();
 	if (!BB || !AIC) return EBTNodeResult::Failed;
 
-	Pawn = AIC->GetPawn();
-	Target = Cast<AActor>(BB->GetValueAsObject(TargetKey.SelectedKeyName));
-	if (!Pawn.IsValid() || !Target.IsValid()) return EBTNodeResult::Failed;
+	APawn* P = AIC->GetPawn();
+	AActor* T = Cast<AActor>(BB->GetValueAsObject(TargetKey.SelectedKeyName));
+	if (!P || !T) return EBTNodeResult::Failed;
 
-	StartTime = Pawn->GetWorld()->GetTimeSeconds();
-	bHasGoalX = false;
-	GoalX = 0.f;
+	// component lookups happen here once, not every tick
+	Mem->Cache.Bind(P);
+	Mem->Target = T;
+	Mem->StartTime = P->GetWorld()->GetTimeSeconds();
+	Mem->bHasGoalX = false;
+	Mem->GoalX = 0.f;
 
 	return EBTNodeResult::InProgress;
 }
 
-void UBTT_MaintainDistance2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*, float)
+void UBTT_MaintainDistance2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float)
 {
-	if (!Pawn.IsValid() || !Target.IsValid())
+	FBTMaintainDistance2DMemory* Mem = CastInstanceNodeMemory<FBTMaintainDistance2DMemory>(NodeMemory);
+	const FMove2DPawnCache& Cache = Mem->Cache;
+
+	APawn* P = Cache.Pawn.Get();
+	const AActor* Target = Mem->Target.Get();
+	if (!P || !Target)
 	{
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		return;
 	}
 
-	UWorld* W = Pawn->GetWorld();
-	APawn* P = Pawn.Get();
+	UWorld* W = P->GetWorld();
 
 	const FVector Me = P->GetActorLocation();
 	const FVector To = Target->GetActorLocation();
@@ -48,64 +64,47 @@ void UBTT_MaintainDistance2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*
 	const float d = DistXZ(Me, To);
 	const float dx = To.X - Me.X;
 
-	// Optional: helper lambdas to cleanly set state/speed
-	auto SetState = [P](EAIMovementState S)
-		{
-			if (auto* E = Cast<ACPP_EnemyParent>(P)) { E->SetAIMoveState(S); }
-		};
-	auto SetSpeedForState = [P](EAIMovementState S)
-		{
-			if (auto* Move = P->FindComponentByClass<UFloatingPawnMovement>())
-			{
-				if (auto* E = Cast<ACPP_EnemyParent>(P))
-				{
-					if (S == EAIMovementState::Run)  Move->MaxSpeed = E->RunSpeed;
-					else if (S == EAIMovementState::Walk) Move->MaxSpeed = E->WalkSpeed;
-				}
-			}
-		};
-
 	// =============== Outside band: close in / back off ===============
 	if (d > PreferMax + BandEpsilon)
 	{
 		// too far → go toward player
-		bHasGoalX = false;
-		Flip(P, dx);
+		Mem->bHasGoalX = false;
+		Flip(Cache, dx);
 
 		// Decide sprint vs walk; tweak 1.5f if you want earlier sprinting
 		const bool bSprint = (d > PreferMax * 1.0f);
 
 		P->AddMovementInput(FVector(FMath::Sign(dx), 0.f, 0.f), 1.f);
 
-		SetState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
-		SetSpeedForState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
+		Cache.SetState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
+		Cache.SetSpeedForState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
 
-		if (bSnapToGround) Snap(P);
+		if (bSnapToGround) Snap(Cache);
 		return;
 	}
 	if (d < PreferMin - BandEpsilon)
 	{
 		// too close → back off
-		bHasGoalX = false;
-		Flip(P, -dx);
+		Mem->bHasGoalX = false;
+		Flip(Cache, -dx);
 
 		// Sprint if *way* too close; tweak 0.5f as you like
 		const bool bSprint = (d < PreferMin * 0.5f);
 
 		P->AddMovementInput(FVector(-FMath::Sign(dx), 0.f, 0.f), 1.f);
 
-		SetState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
-		SetSpeedForState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
+		Cache.SetState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
+		Cache.SetSpeedForState(bSprint ? EAIMovementState::Run : EAIMovementState::Walk);
 
-		if (bSnapToGround) Snap(P);
+		if (bSnapToGround) Snap(Cache);
 		return;
 	}
 
 	// =============== Inside band: post-shot strafe or succeed ===============
 	if (!bRandomizeInBand)
 	{
-		if (auto* M = P->FindComponentByClass<UFloatingPawnMovement>()) M->StopMovementImmediately();
-		SetState(EAIMovementState::Idle);
+		Cache.Stop();
+		Cache.SetState(EAIMovementState::Idle);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
 	}
@@ -116,13 +115,13 @@ void UBTT_MaintainDistance2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*
 		: false;
 
 	// Only pick a new strafe spot after a shot (one-time), and only if we don't already have a goal
-	if (bRequestNew && !bHasGoalX)
+	if (bRequestNew && !Mem->bHasGoalX)
 	{
 		float NewGoalX = 0.f;
-		if (ChooseNewStrafeGoal(W, Me, To, NewGoalX))
+		if (ChooseNewStrafeGoal(W, Me, To, *Mem, NewGoalX))
 		{
-			GoalX = NewGoalX;
-			bHasGoalX = true;
+			Mem->GoalX = NewGoalX;
+			Mem->bHasGoalX = true;
 
 			// consume the request so it won't re-randomize until next shot
 			BB->SetValueAsBool(RequestNewStrafeKey.SelectedKeyName, false);
@@ -131,7 +130,7 @@ void UBTT_MaintainDistance2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*
 			if (!StrafeSpotKey.SelectedKeyName.IsNone())
 			{
 				FVector Ground;
-				if (ProjectGroundAtX(W, NewGoalX, Me.Z, Me.Y, Ground))
+				if (ProjectGroundAtX(W, NewGoalX, Me.Z, Me.Y, P, Ground))
 				{
 					BB->SetValueAsVector(StrafeSpotKey.SelectedKeyName, Ground);
 				}
@@ -140,54 +139,49 @@ void UBTT_MaintainDistance2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8*
 		else
 		{
 			// Couldn't find a good strafe → stop & let Fire proceed
-			if (auto* M = P->FindComponentByClass<UFloatingPawnMovement>()) M->StopMovementImmediately();
-			SetState(EAIMovementState::Idle);
+			Cache.Stop();
+			Cache.SetState(EAIMovementState::Idle);
 			FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 			return;
 		}
 	}
 
 	// If we have a strafe goal, slide to it; otherwise succeed so Fire can run now
-	if (bHasGoalX)
+	if (Mem->bHasGoalX)
 	{
-		const float DirX = FMath::Sign(GoalX - Me.X);
-		Flip(P, DirX);
+		const float DirX = FMath::Sign(Mem->GoalX - Me.X);
+		Flip(Cache, DirX);
 		P->AddMovementInput(FVector(DirX, 0.f, 0.f), 1.f);
 
 		// Strafe is a controlled slide → keep it Walk
-		SetState(EAIMovementState::Walk);
-		SetSpeedForState(EAIMovementState::Walk);
+		Cache.SetState(EAIMovementState::Walk);
+		Cache.SetSpeedForState(EAIMovementState::Walk);
 
-		if (bSnapToGround) Snap(P);
+		if (bSnapToGround) Snap(Cache);
 
-		if (FMath::Abs(Me.X - GoalX) <= StrafeEpsilon)
+		if (FMath::Abs(Me.X - Mem->GoalX) <= StrafeEpsilon)
 		{
-			bHasGoalX = false;
-			if (auto* M = P->FindComponentByClass<UFloatingPawnMovement>()) M->StopMovementImmediately();
-			SetState(EAIMovementState::Idle);
+			Mem->bHasGoalX = false;
+			Cache.Stop();
+			Cache.SetState(EAIMovementState::Idle);
 			FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		}
 		return;
 	}
 
 	// Already in band & no strafe needed → stop & succeed (let Fire run)
-	if (auto* M = P->FindComponentByClass<UFloatingPawnMovement>()) M->StopMovementImmediately();
-	SetState(EAIMovementState::Idle);
+	Cache.Stop();
+	Cache.SetState(EAIMovementState::Idle);
 	FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 }
 
-EBTNodeResult::Type UBTT_MaintainDistance2D::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8*)
+EBTNodeResult::Type UBTT_MaintainDistance2D::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-	if (Pawn.IsValid())
-	{
-		if (auto* M = Pawn->FindComponentByClass<UFloatingPawnMovement>())
-		{
-			M->StopMovementImmediately();
-		}
+	const FMove2DPawnCache& Cache = CastInstanceNodeMemory<FBTMaintainDistance2DMemory>(NodeMemory)->Cache;
+	Cache.Stop();
 
-		// Aborted => Idle
-		SetAIMoveStateIfEnemy(Pawn.Get(), EAIMovementState::Idle);
-	}
+	// Aborted => Idle
+	Cache.SetState(EAIMovementState::Idle);
 	return EBTNodeResult::Aborted;
 }
 
@@ -198,40 +192,39 @@ float UBTT_MaintainDistance2D::DistXZ(const FVector& A, const FVector& B)
 	FVector D = A - B; D.Y = 0.f; return D.Size();
 }
 
-void UBTT_MaintainDistance2D::Snap(APawn* P)
+void UBTT_MaintainDistance2D::Snap(const FMove2DPawnCache& Cache) const
 {
+	APawn* P = Cache.Pawn.Get();
+	if (!P) return;
+
 	const FVector L = P->GetActorLocation();
 	const FVector S = L + FVector(0, 0, 20);
 	const FVector E = S + FVector(0, 0, -GroundTrace);
 
-	FHitResult Hit;
-	FCollisionQueryParams Q(SCENE_QUERY_STAT(Maintain_Snap), false, P);
+	// runs every tick while moving: ask the platform graph, trace only when it has no span below
+	FVector Ground;
+	const UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(P);
+	bool bFound = Graph && Graph->HasData() && Graph->GroundBelow(S, GroundTrace, Ground);
+	if (!bFound)
+	{
+		FHitResult Hit;
+		FCollisionQueryParams Q(SCENE_QUERY_STAT(Maintain_Snap), false, P);
+		bFound = P->GetWorld()->LineTraceSingleByChannel(Hit, S, E, GroundChannel, Q);
+		Ground = Hit.ImpactPoint;
+	}
 
-	if (P->GetWorld()->LineTraceSingleByChannel(Hit, S, E, GroundChannel, Q))
+	if (bFound)
 	{
-		float HH = 0.f;
-		if (const UCapsuleComponent* C = P->FindComponentByClass<UCapsuleComponent>())
-		{
-			HH = C->GetScaledCapsuleHalfHeight();
-		}
-		P->SetActorLocation(FVector(L.X, L.Y, Hit.ImpactPoint.Z + HH), /*bSweep=*/true);
+		P->SetActorLocation(FVector(L.X, L.Y, Ground.Z + Cache.HalfHeight), /*bSweep=*/true);
 	}
 }
 
-void UBTT_MaintainDistance2D::Flip(APawn* P, float DX)
+void UBTT_MaintainDistance2D::Flip(const FMove2DPawnCache& Cache, float DX) const
 {
-	if (!bFlipSpriteX || FMath::Abs(DX) < 1.f) return;
-
-	if (UPaperFlipbookComponent* S = P->FindComponentByClass<UPaperFlipbookComponent>())
-	{
-		const bool Right = (DX >= 0.f);
-		FVector Sc = S->GetRelativeScale3D();
-		Sc.X = FMath::Abs(Sc.X) * (Right ? 1.f : -1.f);
-		S->SetRelativeScale3D(Sc);
-	}
+	if (bFlipSpriteX) Cache.Face(DX);
 }
 
-bool UBTT_MaintainDistance2D::ChooseNewStrafeGoal(UWorld* W, const FVector& Me, const FVector& Player, float& OutGoalX)
+bool UBTT_MaintainDistance2D::ChooseNewStrafeGoal(UWorld* W, const FVector& Me, const FVector& Player, const FBTMaintainDistance2DMemory& Mem, float& OutGoalX) const
 {
 	// random side; distance within band + jitter from player.x
 	const bool  Right = FMath::RandBool();
@@ -246,29 +239,33 @@ bool UBTT_MaintainDistance2D::ChooseNewStrafeGoal(UWorld* W, const FVector& Me,
 
 	// project to ground at that X (same Y as me); optionally require LOS
 	FVector Ground;
-	if (!ProjectGroundAtX(W, DesiredX, Me.Z, Me.Y, Ground)) return false;
+	const APawn* Self = Mem.Cache.Pawn.Get();
+	if (!ProjectGroundAtX(W, DesiredX, Me.Z, Me.Y, Self, Ground)) return false;
 
 	if (bRequireLOSForStrafe)
 	{
-		AActor* TargetPtr = Target.Get();
+		const AActor* TargetPtr = Mem.Target.Get();
 		if (!TargetPtr) return false;
 
 		const FVector Eye = Ground + FVector(0, 0, EyeHeight);
-		if (!HasLOSFrom(W, Eye, TargetPtr)) return false;
+		if (!HasLOSFrom(W, Eye, TargetPtr, Self)) return false;
 	}
 
 	OutGoalX = Ground.X;
 	return true;
 }
 
-bool UBTT_MaintainDistance2D::ProjectGroundAtX(UWorld* W, float X, float StartZ, float Y, FVector& OutGround) const
+bool UBTT_MaintainDistance2D::ProjectGroundAtX(UWorld* W, float X, float StartZ, float Y, const APawn* Ignore, FVector& OutGround) const
 {
 	const float Up = GroundTrace * 0.5f;
 	const FVector Start(X, Y, StartZ + Up);
 	const FVector End(X, Y, StartZ - GroundTrace);
 
+	const UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(W);
+	if (Graph && Graph->HasData() && Graph->GroundBelow(Start, Start.Z - End.Z, OutGround)) return true;
+
 	FHitResult Hit;
-	FCollisionQueryParams Q(SCENE_QUERY_STAT(Strafe_Ground), false, Pawn.Get());
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(Strafe_Ground), false, Ignore);
 
 	if (W->LineTraceSingleByChannel(Hit, Start, End, GroundChannel, Q))
 	{
@@ -278,7 +275,7 @@ bool UBTT_MaintainDistance2D::ProjectGroundAtX(UWorld* W, float X, float StartZ,
 	return false;
 }
 
-bool UBTT_MaintainDistance2D::HasLOSFrom(UWorld* W, const FVector& From, const AActor* To) const
+bool UBTT_MaintainDistance2D::HasLOSFrom(UWorld* W, const FVector& From, const AActor* To, const APawn* Ignore) const
 {
 	if (!W || !To) return false;
 
@@ -289,7 +286,7 @@ bool UBTT_MaintainDistance2D::HasLOSFrom(UWorld* W, const FVector& From, const A
 
 	const FVector End = From + D.GetSafeNormal() * (Dist + 1.f);
 	FHitResult Hit;
-	FCollisionQueryParams Q(SCENE_QUERY_STAT(Strafe_LOS), false, Pawn.Get());
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(Strafe_LOS), false, Ignore);
 
 	const bool bBlocked = W->LineTraceSingleByChannel(Hit, From, End, GroundChannel, Q);
 	return (!bBlocked || Hit.GetActor() == To);
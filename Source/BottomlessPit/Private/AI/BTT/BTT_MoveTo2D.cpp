@@ -6,8 +6,6 @@
 #include "AIController.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/FloatingPawnMovement.h"
-#include "Components/CapsuleComponent.h"
-#include "PaperFlipbookComponent.h" // only used if you want auto-flip
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 
@@ -17,8 +15,19 @@ UBTT_MoveTo2D::UBTT_MoveTo2D()
 	bNotifyTick = true;
 }
 
+void UBTT_MoveTo2D::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTMoveTo2DMemory>(NodeMemory, InitType);
+}
+
+void UBTT_MoveTo2D::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTMoveTo2DMemory>(NodeMemory, CleanupType);
+}
+
 EBTNodeResult::Type UBTT_MoveTo2D::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	FBTMoveTo2DMemory* Mem = CastInstanceNodeMemory<FBTMoveTo2DMemory>(NodeMemory);
 	UBlackboardComponent* BB = OwnerComp.GetBlackboardComponent();
 	AAIController* AIC = OwnerComp.GetAIOwner();
 
@@ -28,12 +37,12 @@ EBTNodeResult::Type UBTT_MoveTo2D::ExecuteTask(UBehaviorTreeComponent& OwnerComp
 	AActor* Target = Cast<AActor>(BB->GetValueAsObject(TargetKey.SelectedKeyName));
 	if (!Pawn || !Target) return EBTNodeResult::Failed;
 
-	CachedPawn = Pawn;
-	CachedTarget = Target;
-	StartTime = Pawn->GetWorld()->GetTimeSeconds();
+	Mem->Cache.Bind(Pawn);
+	Mem->Target = Target;
+	Mem->StartTime = Pawn->GetWorld()->GetTimeSeconds();
 
 	// Make sure movement exists (UFloatingPawnMovement recommended)
-	if (!Pawn->FindComponentByClass<UFloatingPawnMovement>())
+	if (!Mem->Cache.Move.IsValid())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("MoveTo2D_Snap: Pawn has no UFloatingPawnMovement; will still attempt AddMovementInput."));
 	}
@@ -43,36 +52,35 @@ EBTNodeResult::Type UBTT_MoveTo2D::ExecuteTask(UBehaviorTreeComponent& OwnerComp
 
 void UBTT_MoveTo2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
-	if (!CachedPawn.IsValid() || !CachedTarget.IsValid())
+	FBTMoveTo2DMemory* Mem = CastInstanceNodeMemory<FBTMoveTo2DMemory>(NodeMemory);
+	APawn* Pawn = Mem->Cache.Pawn.Get();
+	const AActor* Target = Mem->Target.Get();
+	if (!Pawn || !Target)
 	{
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		return;
 	}
 
-	APawn* Pawn = CachedPawn.Get();
 	const FVector From = Pawn->GetActorLocation();
-	const FVector To = CachedTarget->GetActorLocation();
+	const FVector To = Target->GetActorLocation();
 
 	// Check success radius (2D in XZ plane; ignore Y)
 	if (Dist2D_XZ(From, To) <= AcceptRadius)
 	{
-		if (UFloatingPawnMovement* Move = Pawn->FindComponentByClass<UFloatingPawnMovement>())
-		{
-			Move->StopMovementImmediately();
-		}
+		Mem->Cache.Stop();
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
 	}
 
 	// Horizontal move toward target (ignore Z intent)
-	MoveHorizontalToward(Pawn, To);
+	MoveHorizontalToward(Mem->Cache, To);
 
 	// Optional: keep on ground
-	if (bSnapToGround) SnapDownToGround(Pawn);
+	if (bSnapToGround) SnapDownToGround(Mem->Cache);
 
 	// Timeout safety
 	const float Now = Pawn->GetWorld()->GetTimeSeconds();
-	if (Now - StartTime > MaxTime)
+	if (Now - Mem->StartTime > MaxTime)
 	{
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 	}
@@ -80,13 +88,7 @@ void UBTT_MoveTo2D::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemor
 
 EBTNodeResult::Type UBTT_MoveTo2D::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-	if (CachedPawn.IsValid())
-	{
-		if (UFloatingPawnMovement* Move = CachedPawn->FindComponentByClass<UFloatingPawnMovement>())
-		{
-			Move->StopMovementImmediately();
-		}
-	}
+	CastInstanceNodeMemory<FBTMoveTo2DMemory>(NodeMemory)->Cache.Stop();
 	return EBTNodeResult::Aborted;
 }
 
@@ -97,8 +99,9 @@ float UBTT_MoveTo2D::Dist2D_XZ(const FVector& A, const FVector& B)
 	return D.Size();
 }
 
-void UBTT_MoveTo2D::MoveHorizontalToward(APawn* Pawn, const FVector& TargetLoc)
+void UBTT_MoveTo2D::MoveHorizontalToward(const FMove2DPawnCache& Cache, const FVector& TargetLoc) const
 {
+	APawn* Pawn = Cache.Pawn.Get();
 	const FVector From = Pawn->GetActorLocation();
 	FVector Delta = TargetLoc - From;
 
@@ -106,15 +109,16 @@ void UBTT_MoveTo2D::MoveHorizontalToward(APawn* Pawn, const FVector& TargetLoc)
 	Delta.Y = 0.f; // XZ plane, lock Y
 
 	// Flip sprite if desired
-	UpdateFlip(Pawn, Delta.X);
+	if (bFlipSpriteX) Cache.Face(Delta.X);
 
 	// Feed the movement component with purely horizontal direction
 	const FVector Dir = FVector(FMath::Sign(Delta.X), 0.f, 0.f);
 	Pawn->AddMovementInput(Dir, 1.f);
 }
 
-void UBTT_MoveTo2D::SnapDownToGround(APawn* Pawn)
+void UBTT_MoveTo2D::SnapDownToGround(const FMove2DPawnCache& Cache) const
 {
+	APawn* Pawn = Cache.Pawn.Get();
 	const FVector Loc = Pawn->GetActorLocation();
 
 	// Trace down from a little above the pawn to catch ground
@@ -135,13 +139,8 @@ void UBTT_MoveTo2D::SnapDownToGround(APawn* Pawn)
 
 	if (!bHit) return;
 
-	float HalfHeight = 0.f;
-	if (const UCapsuleComponent* Cap = Pawn->FindComponentByClass<UCapsuleComponent>())
-	{
-		HalfHeight = Cap->GetScaledCapsuleHalfHeight();
-	}
 	// Place pawn so capsule bottom rests slightly above the hit point
-	const float NewZ = Hit.ImpactPoint.Z + HalfHeight + GroundOffset;
+	const float NewZ = Hit.ImpactPoint.Z + Cache.HalfHeight + GroundOffset;
 	if (!FMath::IsNearlyEqual(NewZ, Loc.Z, 0.1f))
 	{
 		FVector NewLoc = Loc;
@@ -154,22 +153,3 @@ void UBTT_MoveTo2D::SnapDownToGround(APawn* Pawn)
 		// if (SweepHit.IsValidBlockingHit() && SweepHit.Normal.Z < MinWalkableNormalZ) { /* handle steep slope */ }
 	}
 }
-
-void UBTT_MoveTo2D::UpdateFlip(APawn* Pawn, float DeltaX)
-{
-	if (!bFlipSpriteX) return;
-
-	// Flip only if we have intent to move left/right
-	if (FMath::Abs(DeltaX) < 1.f) return;
-
-	if (UPaperFlipbookComponent* Sprite = Pawn->FindComponentByClass<UPaperFlipbookComponent>())
-	{
-		const bool bRight = (DeltaX >= 0.f);
-		FVector S = Sprite->GetRelativeScale3D();
-		S.X = FMath::Abs(S.X) * (bRight ? 1.f : -1.f);
-		Sprite->SetRelativeScale3D(S);
-	}
-}
-
-
-
@@ -4,9 +4,6 @@
 #include "AI/BTT/BTT_MoveToLocation2D_Snap.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "AIController.h"
-#include "GameFramework/FloatingPawnMovement.h"
-#include "Components/CapsuleComponent.h"
-#include "PaperFlipbookComponent.h"
 
 UBTT_MoveToLocation2D_Snap::UBTT_MoveToLocation2D_Snap()
 {
@@ -14,68 +11,78 @@ UBTT_MoveToLocation2D_Snap::UBTT_MoveToLocation2D_Snap()
 	bNotifyTick = true;
 }
 
+void UBTT_MoveToLocation2D_Snap::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FBTMoveToLocation2DMemory>(NodeMemory, InitType);
+}
+
+void UBTT_MoveToLocation2D_Snap::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FBTMoveToLocation2DMemory>(NodeMemory, CleanupType);
+}
+
 EBTNodeResult::Type UBTT_MoveToLocation2D_Snap::ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
+	FBTMoveToLocation2DMemory* Mem = CastInstanceNodeMemory<FBTMoveToLocation2DMemory>(NodeMemory);
 	auto* BB = OwnerComp.GetBlackboardComponent();
 	auto* AIC = OwnerComp.GetAIOwner();
 	if (!BB || !AIC) return EBTNodeResult::Failed;
 
-	Pawn = AIC->GetPawn();
-	if (!Pawn.IsValid()) return EBTNodeResult::Failed;
+	APawn* P = AIC->GetPawn();
+	if (!P) return EBTNodeResult::Failed;
 
-	TargetLoc = BB->GetValueAsVector(LocationKey.SelectedKeyName);
-	StartTime = Pawn->GetWorld()->GetTimeSeconds();
+	Mem->Cache.Bind(P);
+	Mem->TargetLoc = BB->GetValueAsVector(LocationKey.SelectedKeyName);
+	Mem->StartTime = P->GetWorld()->GetTimeSeconds();
 	return EBTNodeResult::InProgress;
 }
 
 void UBTT_MoveToLocation2D_Snap::TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float)
 {
-	if (!Pawn.IsValid())
+	FBTMoveToLocation2DMemory* Mem = CastInstanceNodeMemory<FBTMoveToLocation2DMemory>(NodeMemory);
+	const FMove2DPawnCache& Cache = Mem->Cache;
+
+	APawn* P = Cache.Pawn.Get();
+	if (!P)
 	{
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 		return;
 	}
 
-	APawn* P = Pawn.Get();
-
 	// success radius (XZ only)
-	if (Dist2D_XZ(P->GetActorLocation(), TargetLoc) <= AcceptRadius)
+	if (Dist2D_XZ(P->GetActorLocation(), Mem->TargetLoc) <= AcceptRadius)
 	{
-		if (UFloatingPawnMovement* M = P->FindComponentByClass<UFloatingPawnMovement>())
-			M->StopMovementImmediately();
+		Cache.Stop();
 
 		// arrived -> Idle
-		SetStateIfEnemy(P, EAIMovementState::Idle);
+		Cache.SetState(EAIMovementState::Idle);
 
 		FinishLatentTask(OwnerComp, EBTNodeResult::Succeeded);
 		return;
 	}
 
 	// drive horizontal movement and mark Walk
-	MoveHorizontalToward(P, TargetLoc);
-	SetStateIfEnemy(P, EAIMovementState::Walk);
+	MoveHorizontalToward(Cache, Mem->TargetLoc);
+	Cache.SetState(EAIMovementState::Walk);
 
 	// optional ground snap
-	if (bSnapToGround) SnapDown(P);
+	if (bSnapToGround) SnapDown(Cache);
 
 	// timeout -> fail + Idle
-	if (P->GetWorld()->GetTimeSeconds() - StartTime > MaxTime)
+	if (P->GetWorld()->GetTimeSeconds() - Mem->StartTime > MaxTime)
 	{
-		SetStateIfEnemy(P, EAIMovementState::Idle);
+		Cache.SetState(EAIMovementState::Idle);
 		FinishLatentTask(OwnerComp, EBTNodeResult::Failed);
 	}
 }
 
 EBTNodeResult::Type UBTT_MoveToLocation2D_Snap::AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
 {
-	if (Pawn.IsValid())
-	{
-		if (UFloatingPawnMovement* M = Pawn->FindComponentByClass<UFloatingPawnMovement>())
-			M->StopMovementImmediately();
+	const FMove2DPawnCache& Cache = CastInstanceNodeMemory<FBTMoveToLocation2DMemory>(NodeMemory)->Cache;
+	Cache.Stop();
 
-		// aborted -> Idle
-		SetStateIfEnemy(Pawn.Get(), EAIMovementState::Idle);
-	}
+	// aborted -> Idle
+	Cache.SetState(EAIMovementState::Idle);
 	return EBTNodeResult::Aborted;
 }
 
@@ -86,21 +93,23 @@ float UBTT_MoveToLocation2D_Snap::Dist2D_XZ(const FVector& A, const FVector& B)
 	return D.Size();
 }
 
-void UBTT_MoveToLocation2D_Snap::MoveHorizontalToward(APawn* P, const FVector& To)
+void UBTT_MoveToLocation2D_Snap::MoveHorizontalToward(const FMove2DPawnCache& Cache, const FVector& To) const
 {
+	APawn* P = Cache.Pawn.Get();
 	FVector D = To - P->GetActorLocation();
 	D.Y = 0.f;
 
 	// flip sprite to face direction
-	Flip(P, D.X);
+	Cache.Face(D.X);
 
 	// horizontal input only
 	const float DirX = FMath::Sign(D.X);
 	P->AddMovementInput(FVector(DirX, 0.f, 0.f), 1.f);
 }
 
-void UBTT_MoveToLocation2D_Snap::SnapDown(APawn* P)
+void UBTT_MoveToLocation2D_Snap::SnapDown(const FMove2DPawnCache& Cache) const
 {
+	APawn* P = Cache.Pawn.Get();
 	const FVector Loc = P->GetActorLocation();
 	const FVector Start = Loc + FVector(0, 0, 20);
 	const FVector End = Start + FVector(0, 0, -FMath::Max(1.f, GroundTraceDistance));
@@ -110,28 +119,8 @@ void UBTT_MoveToLocation2D_Snap::SnapDown(APawn* P)
 
 	if (P->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, GroundTraceChannel, Q))
 	{
-		float HalfHeight = 0.f;
-		if (const UCapsuleComponent* Cap = P->FindComponentByClass<UCapsuleComponent>())
-			HalfHeight = Cap->GetScaledCapsuleHalfHeight();
-
 		FVector NewLoc = Loc;
-		NewLoc.Z = Hit.ImpactPoint.Z + HalfHeight;
+		NewLoc.Z = Hit.ImpactPoint.Z + Cache.HalfHeight;
 		P->SetActorLocation(NewLoc, /*bSweep=*/true);
 	}
 }
-
-void UBTT_MoveToLocation2D_Snap::Flip(APawn* P, float DX)
-{
-	if (FMath::Abs(DX) < 1.f) return;
-
-	if (UPaperFlipbookComponent* Sprite = P->FindComponentByClass<UPaperFlipbookComponent>())
-	{
-		const bool bRight = DX >= 0.f;
-		FVector S = Sprite->GetRelativeScale3D();
-		S.X = FMath::Abs(S.X) * (bRight ? 1.f : -1.f);
-		Sprite->SetRelativeScale3D(S);
-	}
-}
-
-
-
@@ -0,0 +1,66 @@
+﻿// Move2DPawnCache.cpp
+
+
+#include "AI/BTT/Move2DPawnCache.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/FloatingPawnMovement.h"
+#include "Components/CapsuleComponent.h"
+#include "PaperFlipbookComponent.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+
+void FMove2DPawnCache::Bind(APawn* InPawn)
+{
+	Reset();
+	if (!InPawn) return;
+
+	Pawn = InPawn;
+	Enemy = Cast<ACPP_EnemyParent>(InPawn);
+	Move = InPawn->FindComponentByClass<UFloatingPawnMovement>();
+	Sprite = InPawn->FindComponentByClass<UPaperFlipbookComponent>();
+
+	if (const UCapsuleComponent* Cap = InPawn->FindComponentByClass<UCapsuleComponent>())
+	{
+		HalfHeight = Cap->GetScaledCapsuleHalfHeight();
+	}
+}
+
+void FMove2DPawnCache::SetState(EAIMovementState State) const
+{
+	// SetAIMoveState is a no-op (no broadcast) when unchanged
+	if (ACPP_EnemyParent* E = Enemy.Get()) E->SetAIMoveState(State);
+}
+
+void FMove2DPawnCache::SetMaxSpeed(float Speed) const
+{
+	UFloatingPawnMovement* M = Move.Get();
+	if (M && M->MaxSpeed != Speed) M->MaxSpeed = Speed;
+}
+
+void FMove2DPawnCache::SetSpeedForState(EAIMovementState State) const
+{
+	const ACPP_EnemyParent* E = Enemy.Get();
+	if (!E) return;
+
+	if (State == EAIMovementState::Run)       SetMaxSpeed(E->RunSpeed);
+	else if (State == EAIMovementState::Walk) SetMaxSpeed(E->WalkSpeed);
+}
+
+void FMove2DPawnCache::Stop() const
+{
+	if (UFloatingPawnMovement* M = Move.Get()) M->StopMovementImmediately();
+}
+
+void FMove2DPawnCache::Face(float DX) const
+{
+	if (FMath::Abs(DX) < 1.f) return;
+
+	UPaperFlipbookComponent* S = Sprite.Get();
+	if (!S) return;
+
+	const bool bRight = (DX >= 0.f);
+	FVector Sc = S->GetRelativeScale3D();
+	if ((Sc.X >= 0.f) == bRight) return;
+
+	Sc.X = FMath::Abs(Sc.X) * (bRight ? 1.f : -1.f);
+	S->SetRelativeScale3D(Sc);
+}
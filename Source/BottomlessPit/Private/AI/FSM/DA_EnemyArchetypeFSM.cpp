@@ -0,0 +1,69 @@
+﻿// DA_EnemyArchetypeFSM.cpp
+
+
+#include "AI/FSM/DA_EnemyArchetypeFSM.h"
+
+namespace
+{
+	FEnemyFSMTransition MakeTransition(EEnemyFSMCondition Condition, FName To, float Value = 0.f)
+	{
+		FEnemyFSMTransition T;
+		T.Condition = Condition;
+		T.Value = Value;
+		T.ToState = To;
+		return T;
+	}
+}
+
+UDA_EnemyArchetypeFSM::UDA_EnemyArchetypeFSM()
+{
+	ResetToRangedDefaults();
+}
+
+int32 UDA_EnemyArchetypeFSM::FindState(FName StateName) const
+{
+	return States.IndexOfByPredicate([StateName](const FEnemyFSMState& S) { return S.Name == StateName; });
+}
+
+void UDA_EnemyArchetypeFSM::ResetToRangedDefaults()
+{
+	const FName Idle(TEXT("Idle"));
+	const FName Hold(TEXT("HoldBand"));
+	const FName Fire(TEXT("Fire"));
+	const FName Repo(TEXT("Reposition"));
+	const FName Jump(TEXT("JumpUp"));
+
+	States.Reset();
+	InitialState = Idle;
+
+	// same decisions as UEnemyFSMComponent's Mode + the ranged BT under it
+	FEnemyFSMState& S0 = States.AddDefaulted_GetRef();
+	S0.Name = Idle;
+	S0.Action = EEnemyFSMAction::Idle;
+	S0.Transitions.Add(MakeTransition(EEnemyFSMCondition::HasTarget, Hold));
+
+	FEnemyFSMState& S1 = States.AddDefaulted_GetRef();
+	S1.Name = Hold;
+	S1.Action = EEnemyFSMAction::HoldBand;
+	S1.Transitions.Add(MakeTransition(EEnemyFSMCondition::NoTarget, Idle));
+	S1.Transitions.Add(MakeTransition(EEnemyFSMCondition::NoLOS, Repo));
+	S1.Transitions.Add(MakeTransition(EEnemyFSMCondition::ActionSucceeded, Fire));
+
+	FEnemyFSMState& S2 = States.AddDefaulted_GetRef();
+	S2.Name = Fire;
+	S2.Action = EEnemyFSMAction::Fire;
+	S2.Transitions.Add(MakeTransition(EEnemyFSMCondition::ActionDone, Hold));
+
+	FEnemyFSMState& S3 = States.AddDefaulted_GetRef();
+	S3.Name = Repo;
+	S3.Action = EEnemyFSMAction::Reposition;
+	S3.Transitions.Add(MakeTransition(EEnemyFSMCondition::NoTarget, Idle));
+	S3.Transitions.Add(MakeTransition(EEnemyFSMCondition::HasLOS, Hold));
+	S3.Transitions.Add(MakeTransition(EEnemyFSMCondition::TargetAbove, Jump, 120.f));
+	S3.Transitions.Add(MakeTransition(EEnemyFSMCondition::ActionDone, Hold));
+
+	FEnemyFSMState& S4 = States.AddDefaulted_GetRef();
+	S4.Name = Jump;
+	S4.Action = EEnemyFSMAction::JumpUp;
+	S4.Transitions.Add(MakeTransition(EEnemyFSMCondition::ActionDone, Hold));
+}
@@ -9,6 +9,9 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Utility/Util_BpAsyncVFXFlipbooks.h"
 #include "GameFramework/Character.h"
+#include "Subsystem/WS_FVXPool.h"
+#include "Subsystem/WS_VFXRowCache.h"
+#include "Subsystem/WS_TrailBatch.h"
 
 ACPP_FVX::ACPP_FVX()
 {
@@ -39,11 +42,21 @@ void ACPP_FVX::PoolObjectToGameMode_Implementation()
 
 void ACPP_FVX::ActivateTrail(const FVector& From, const FVector& To)
 {
-	if (!TrailSprite || !bTrailReady) return;
-
 	FVector S = From, E = To;
 	if (!FMath::IsNaN(ForcePlaneY)) { S.Y = ForcePlaneY; E.Y = ForcePlaneY; }
 
+	// Batched renderer: one instance slot, fade runs in the material
+	if (UWS_TrailBatch* Batch = UWS_TrailBatch::Get(this))
+	{
+		if (Batch->IsConfigured())
+		{
+			Batch->AddTrail(S, E, Thickness, 1.05f, HeadTaper, TrailLife, TileWorldUU, bUseDashes);
+			return;
+		}
+	}
+
+	if (!TrailSprite || !bTrailReady) return;
+
 	const FVector2D D2(E.X - S.X, E.Z - S.Z);
 	float Len2D = D2.Size();
 	if (Len2D <= KINDA_SMALL_NUMBER) return;
@@ -109,29 +122,7 @@ void ACPP_FVX::ActivateVFXByName(FName RowName, const FVector& ImpactLoc)
 	if (!VFXDataTable || RowName.IsNone())
 		return;
 
-	if (const FVFXAnimationResolved* Found = CachedRows.Find(RowName))
-	{
-		PlayResolvedLocation(*Found, ImpactLoc);
-		return;
-	}
-
-	if (InFlight.Contains(RowName))
-	{
-		PendingLocations.FindOrAdd(RowName).Add(ImpactLoc);
-		return;
-	}
-
-	PendingLocations.FindOrAdd(RowName).Add(ImpactLoc);
-
-	UUtil_BpAsyncVFXFlipbooks* Loader =
-		UUtil_BpAsyncVFXFlipbooks::LoadVFXFlipbooksRowAsync(this, VFXDataTable, RowName);
-
-	if (!Loader) return;
-
-	InFlight.Add(RowName, Loader);
-	Loader->OnCompleted.AddDynamic(this, &ACPP_FVX::OnLoaderCompleted);
-	Loader->OnFailed.AddDynamic(this, &ACPP_FVX::OnLoaderFailed);
-	Loader->Activate();
+	RequestSharedRow(RowName, FTransform(ImpactLoc), true);
 }
 
 void ACPP_FVX::ActivateVFXByNameTransform(FName RowName, const FTransform& WorldTransform)
@@ -139,29 +130,31 @@ void ACPP_FVX::ActivateVFXByNameTransform(FName RowName, const FTransform& World
 	if (!VFXDataTable || RowName.IsNone())
 		return;
 
-	if (const FVFXAnimationResolved* Found = CachedRows.Find(RowName))
-	{
-		PlayResolvedTransform(*Found, WorldTransform);
-		return;
-	}
+	RequestSharedRow(RowName, WorldTransform, false);
+}
+
+void ACPP_FVX::RequestSharedRow(FName RowName, const FTransform& WorldTransform, bool bAllowFace)
+{
+	UWS_VFXRowCache* Cache = UWS_VFXRowCache::Get(this);
+	if (!Cache) return;
 
-	if (InFlight.Contains(RowName))
+	if (const FVFXAnimationResolved* Found = Cache->Find(VFXDataTable, RowName))
 	{
-		PendingTransforms.FindOrAdd(RowName).Add(WorldTransform);
+		PlayResolvedInternal(*Found, WorldTransform, bAllowFace);
 		return;
 	}
 
-	PendingTransforms.FindOrAdd(RowName).Add(WorldTransform);
-
-	UUtil_BpAsyncVFXFlipbooks* Loader =
-		UUtil_BpAsyncVFXFlipbooks::LoadVFXFlipbooksRowAsync(this, VFXDataTable, RowName);
+	// Row still loading: only the newest request plays, and we join the load once per row
+	const bool bAlreadyWaiting = (PendingRow == RowName);
+	PendingRow = RowName;
+	PendingTransform = WorldTransform;
+	bPendingFace = bAllowFace;
 
-	if (!Loader) return;
-
-	InFlight.Add(RowName, Loader);
-	Loader->OnCompleted.AddDynamic(this, &ACPP_FVX::OnLoaderCompleted);
-	Loader->OnFailed.AddDynamic(this, &ACPP_FVX::OnLoaderFailed);
-	Loader->Activate();
+	if (!bAlreadyWaiting)
+	{
+		Cache->Request(VFXDataTable, RowName,
+			FOnVFXRowResolved::CreateUObject(this, &ACPP_FVX::OnSharedRowResolved, RowName));
+	}
 }
 
 void ACPP_FVX::BeginPlay()
@@ -290,6 +283,16 @@ void ACPP_FVX::DeActivateVFX()
 	VFXPivot->SetWorldLocation(OriginLoc, false, nullptr, ETeleportType::TeleportPhysics);
 	SetActorHiddenInGame(true);
 	SetActorTickEnabled(false);
+
+	// Natively pooled: straight back to the free list, no BP dispatch
+	if (!PoolRow.IsNone())
+	{
+		if (UWS_FVXPool* Pool = UWS_FVXPool::Get(this))
+		{
+			Pool->Release(this);
+			return;
+		}
+	}
 	PoolObjectToGameMode();
 
 }
@@ -322,44 +325,16 @@ FRotator ACPP_FVX::ComputeLookAtFromPlayer(const FVector& Target) const
 	return UKismetMathLibrary::FindLookAtRotation(Start, Target);
 }
 
-void ACPP_FVX::OnLoaderCompleted(FName RowName, const FVFXAnimationResolved& VFX)
+void ACPP_FVX::OnSharedRowResolved(const FVFXAnimationResolved* Resolved, FName RowName)
 {
-	CachedRows.Add(RowName, VFX);
+	// a newer request for another row superseded this one
+	if (PendingRow != RowName) return;
+	PendingRow = NAME_None;
 
-	if (TObjectPtr<UUtil_BpAsyncVFXFlipbooks>* L = InFlight.Find(RowName))
+	if (Resolved)
 	{
-		if (L->Get())
-		{
-			L->Get()->OnCompleted.RemoveAll(this);
-			L->Get()->OnFailed.RemoveAll(this);
-		}
+		PlayResolvedInternal(*Resolved, PendingTransform, bPendingFace);
 	}
-	InFlight.Remove(RowName);
-
-	if (TArray<FTransform>* Transforms = PendingTransforms.Find(RowName))
-	{
-		const FTransform UseTransform = Transforms->Last();
-		PendingTransforms.Remove(RowName);
-
-		PlayResolvedTransform(VFX, UseTransform);
-		return;
-	}
-
-	if (TArray<FVector>* Locations = PendingLocations.Find(RowName))
-	{
-		const FVector UseLoc = Locations->Last();
-		PendingLocations.Remove(RowName);
-
-		PlayResolvedLocation(VFX, UseLoc);
-		return;
-	}
-}
-
-void ACPP_FVX::OnLoaderFailed()
-{
-	InFlight.Reset();
-	PendingLocations.Reset();
-	PendingTransforms.Reset();
 }
 
 void ACPP_FVX::PlayResolvedInternal(const FVFXAnimationResolved& Resolved, const FTransform& WorldTransform, bool bAllowFace)
@@ -4,6 +4,8 @@
 #include "PaperFlipbookComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
+#include "Game/CPP_PC_BottomlessPit.h"
 
 // Sets default values
 ACPP_Gun::ACPP_Gun()
@@ -66,10 +68,18 @@ FVector ACPP_Gun::GetMuzzleWorldLocation() const
 
 void ACPP_Gun::CoreHitscanFromMuzzle_PastCursor()
 {
-    if (!GetWorld()) return;
+    FVector Dir;
+    if (!ResolvePastCursorAimDir(Dir)) return;
+
+    CoreHitscanBatch({ Dir });
+}
+
+bool ACPP_Gun::ResolvePastCursorAimDir(FVector& OutDir) const
+{
+    if (!GetWorld()) return false;
 
     FVector CursorOnPlane;
-    if (!GetCursorWorldOnOwnerPlane(CursorOnPlane)) return;
+    if (!GetCursorWorldOnOwnerPlane(CursorOnPlane)) return false;
 
     const FVector Start = GetMuzzleWorldLocation();
 
@@ -95,35 +105,228 @@ void ACPP_Gun::CoreHitscanFromMuzzle_PastCursor()
     const float Along = FVector::DotProduct(Delta, FwdFlat);
 
     // If the cursor is sufficiently in front, use it; otherwise snap forward
-    const FVector Dir = (Along > FrontGateDist && !Delta.IsNearlyZero())
+    OutDir = (Along > FrontGateDist && !Delta.IsNearlyZero())
         ? Delta.GetSafeNormal()
         : FwdFlat;
+    return true;
+}
 
-    const FVector End = Start + Dir * TraceRange;
+// ---------- Batched hitscan ----------
+
+void ACPP_Gun::CoreHitscanSpreadFromMuzzle(const FVector& AimDir, int32 RayCount, float SpreadAngleDeg)
+{
+    FVector Center = AimDir; Center.Y = 0.f;
+    if (!Center.Normalize() || RayCount <= 0) return;
+
+    TArray<FVector> Dirs;
+    Dirs.Reserve(RayCount);
+
+    if (RayCount == 1 || SpreadAngleDeg <= KINDA_SMALL_NUMBER)
+    {
+        Dirs.Init(Center, RayCount);
+    }
+    else
+    {
+        // Even fan around the game-plane normal (Y), edge to edge
+        const float Step = SpreadAngleDeg / float(RayCount - 1);
+        const float First = -0.5f * SpreadAngleDeg;
+        for (int32 i = 0; i < RayCount; ++i)
+        {
+            Dirs.Add(Center.RotateAngleAxis(First + Step * i, FVector::RightVector));
+        }
+    }
+
+    CoreHitscanBatch(Dirs);
+}
+
+void ACPP_Gun::CoreHitscanSpreadFromMuzzle_PastCursor(int32 RayCount, float SpreadAngleDeg)
+{
+    FVector Dir;
+    if (!ResolvePastCursorAimDir(Dir)) return;
 
+    CoreHitscanSpreadFromMuzzle(Dir, RayCount, SpreadAngleDeg);
+}
+
+void ACPP_Gun::CoreHitscanBatch(const TArray<FVector>& AimDirs)
+{
+    UWorld* World = GetWorld();
+    if (!World || AimDirs.Num() == 0) return;
+
+    const FVector Start = GetMuzzleWorldLocation();
+    const FCollisionQueryParams QP = MakeHitscanQueryParams();
+    const FCollisionResponseParams RP = MakeHitscanResponseParams();
+    const bool bMulti = MaxPenetrations > 0;
+
+    FHitscanBatch Batch;
+    Batch.Rays.Reserve(AimDirs.Num());
+    for (const FVector& AimDir : AimDirs)
+    {
+        // Lock and normalize to 2D plane
+        FVector Dir = AimDir; Dir.Y = 0.f;
+        if (!Dir.Normalize()) continue;
+
+        FHitscanRay& Ray = Batch.Rays.AddDefaulted_GetRef();
+        Ray.Start = Start;
+        Ray.Dir = Dir;
+        Ray.End = Start + Dir * TraceRange;
+    }
+    if (Batch.Rays.Num() == 0) return;
+
+    if (!bAsyncHitscan)
+    {
+        for (FHitscanRay& Ray : Batch.Rays)
+        {
+            if (bMulti)
+            {
+                World->LineTraceMultiByChannel(Ray.Hits, Ray.Start, Ray.End, FireTraceChannel, QP, RP);
+                FilterPenetrationHits(Ray.Hits);
+            }
+            else
+            {
+                FHitResult Hit;
+                if (World->LineTraceSingleByChannel(Hit, Ray.Start, Ray.End, FireTraceChannel, QP, RP))
+                {
+                    Ray.Hits.Add(Hit);
+                }
+            }
+        }
+        ResolveHitscanBatch(Batch);
+        return;
+    }
+
+    if (!HitscanTraceDelegate.IsBound())
+    {
+        HitscanTraceDelegate.BindUObject(this, &ACPP_Gun::OnAsyncHitscanTraceDone);
+    }
+
+    // Batch id rides in UserData; results come back next frame on the game thread
+    const uint32 BatchId = NextHitscanBatchId++;
+    if (NextHitscanBatchId == 0) NextHitscanBatchId = 1;
+
+    const EAsyncTraceType TraceType = bMulti ? EAsyncTraceType::Multi : EAsyncTraceType::Single;
+    for (FHitscanRay& Ray : Batch.Rays)
+    {
+        Ray.Handle = World->AsyncLineTraceByChannel(TraceType, Ray.Start, Ray.End, FireTraceChannel, QP, RP, &HitscanTraceDelegate, BatchId);
+    }
+    Batch.Remaining = Batch.Rays.Num();
+    PendingHitscanBatches.Add(BatchId, MoveTemp(Batch));
+}
+
+FCollisionQueryParams ACPP_Gun::MakeHitscanQueryParams() const
+{
     FCollisionQueryParams QP(SCENE_QUERY_STAT(GunHitscan), false, this);
     if (AActor* OwnerActor = GetOwner()) QP.AddIgnoredActor(OwnerActor);
-    QP.AddIgnoredActor(this);
+    return QP;
+}
 
-    FHitResult Hit;
-    const bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, Start, End, FireTraceChannel, QP);
+FCollisionResponseParams ACPP_Gun::MakeHitscanResponseParams() const
+{
+    FCollisionResponseParams RP = FCollisionResponseParams::DefaultResponseParam;
 
-    if (bDrawDebug)
+    // Penetrating rays must not stop at the first blocker: demote everything to overlap
+    // and let FilterPenetrationHits decide where the ray ends.
+    if (MaxPenetrations > 0)
     {
-        const FVector DrawEnd = bHit ? Hit.ImpactPoint : End;
-        DrawDebugLine(GetWorld(), Start, DrawEnd, FColor::Yellow, false, 0.12f, 0, 1.5f);
-        DrawDebugPoint(GetWorld(), DrawEnd, 6.f, bHit ? FColor::Red : FColor::Green, false, 0.12f);
+        RP.CollisionResponse.SetAllChannels(ECR_Overlap);
     }
+    return RP;
+}
 
-    if (bHit)
+void ACPP_Gun::FilterPenetrationHits(TArray<FHitResult>& InOutHits) const
+{
+    InOutHits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Distance < B.Distance; });
+
+    TArray<FHitResult> Kept;
+    Kept.Reserve(FMath::Min(InOutHits.Num(), MaxPenetrations + 1));
+
+    TSet<const AActor*> Seen;
+    for (const FHitResult& Hit : InOutHits)
     {
-        // Apply damage/impact here
-        UGameplayStatics::ApplyPointDamage(Hit.GetActor(), Damage, Dir, Hit, nullptr, this, DamageTypeClass);
-        ShootOnHit(Hit);
+        // Responses were demoted to overlap for the query; only what really blocks the fire channel is a hit
+        // (pickups, triggers and sensors that merely overlap it are not)
+        const UPrimitiveComponent* HitComp = Hit.GetComponent();
+        if (!HitComp || HitComp->GetCollisionResponseToChannel(FireTraceChannel) != ECR_Block) continue;
+
+        const AActor* HitActor = Hit.GetActor();
+        if (HitActor)
+        {
+            // One hit per actor (multi-component pawns report several)
+            bool bAlreadySeen = false;
+            Seen.Add(HitActor, &bAlreadySeen);
+            if (bAlreadySeen) continue;
+        }
+
+        Kept.Add(Hit);
+
+        // Level geometry (strips, walls) ends the ray; pawns are penetrated up to the cap
+        if (!Cast<APawn>(HitActor) || Kept.Num() > MaxPenetrations) break;
     }
-    else
+
+    InOutHits = MoveTemp(Kept);
+}
+
+void ACPP_Gun::OnAsyncHitscanTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    FHitscanBatch* Batch = PendingHitscanBatches.Find(Datum.UserData);
+    if (!Batch) return;
+
+    for (FHitscanRay& Ray : Batch->Rays)
     {
-        // Miss FX to End (tracer, dust, etc.)
+        if (Ray.Handle != Handle) continue;
+
+        if (MaxPenetrations > 0)
+        {
+            Ray.Hits = MoveTemp(Datum.OutHits);
+            FilterPenetrationHits(Ray.Hits);
+        }
+        else
+        {
+            for (const FHitResult& Hit : Datum.OutHits)
+            {
+                if (Hit.bBlockingHit) { Ray.Hits.Add(Hit); break; }
+            }
+        }
+        --Batch->Remaining;
+        break;
+    }
+
+    if (Batch->Remaining <= 0)
+    {
+        FHitscanBatch Done = MoveTemp(*Batch);
+        PendingHitscanBatches.Remove(Datum.UserData);
+        ResolveHitscanBatch(Done);
+    }
+}
+
+void ACPP_Gun::ResolveHitscanBatch(FHitscanBatch& Batch)
+{
+    TArray<FHitResult> AllHits;
+
+    for (const FHitscanRay& Ray : Batch.Rays)
+    {
+        if (bDrawDebug)
+        {
+            const bool bHit = Ray.Hits.Num() > 0;
+            const FVector DrawEnd = bHit ? Ray.Hits.Last().ImpactPoint : Ray.End;
+            DrawDebugLine(GetWorld(), Ray.Start, DrawEnd, FColor::Yellow, false, 0.12f, 0, 1.5f);
+            for (const FHitResult& Hit : Ray.Hits)
+            {
+                DrawDebugPoint(GetWorld(), Hit.ImpactPoint, 6.f, FColor::Red, false, 0.12f);
+            }
+            if (!bHit) DrawDebugPoint(GetWorld(), DrawEnd, 6.f, FColor::Green, false, 0.12f);
+        }
+
+        for (const FHitResult& Hit : Ray.Hits)
+        {
+            // Apply damage/impact here
+            UGameplayStatics::ApplyPointDamage(Hit.GetActor(), Damage, Ray.Dir, Hit, nullptr, this, DamageTypeClass);
+            AllHits.Add(Hit);
+        }
+    }
+
+    if (AllHits.Num() > 0)
+    {
+        ShootOnHitBatch(AllHits);
     }
 }
 
@@ -159,6 +362,14 @@ void ACPP_Gun::ShootOnHit_Implementation(FHitResult ShootResult)
    // UE_LOG(LogTemp, Warning, TEXT("ShootOnHit called with actor: %s"), *GetNameSafe(ShootResult.GetActor()));
 }
 
+void ACPP_Gun::ShootOnHitBatch_Implementation(const TArray<FHitResult>& ShootResults)
+{
+    for (const FHitResult& Hit : ShootResults)
+    {
+        ShootOnHit(Hit);
+    }
+}
+
 
 
 // Called when the game starts or when spawned
@@ -184,6 +395,15 @@ bool ACPP_Gun::GetCursorWorldOnOwnerPlane(FVector& OutWorld) const
     APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
     if (!PC) return false;
 
+    // Same sample the arm aimed with this frame (owner is the possessed pawn, same plane)
+    if (const ACPP_PC_BottomlessPit* BlpPC = Cast<ACPP_PC_BottomlessPit>(PC))
+    {
+        const FCursorSample2D& Cursor = BlpPC->GetCursorSample();
+        if (!Cursor.bValid) return false;
+        OutWorld = Cursor.WorldOnPlane;
+        return true;
+    }
+
     FVector WL, WD;
     if (!PC->DeprojectMousePositionToWorld(WL, WD)) return false;
 
@@ -12,6 +12,9 @@
 #include "Components/CPP_GunComponent.h"
 #include "Utility/Util_BpAsyncFireModeProfile.h" 
 #include "Engine/CollisionProfile.h"
+#include "Actor/LevelActor/LaneLevelGenerator.h"
+#include "EngineUtils.h"
+#include "Subsystem/WS_SpatialHash2D.h"
 
 
 
@@ -72,11 +75,7 @@ void ACPP_ProjectileParent::ConfigureFromOwnerFireMode()
 	bAutoImpactOnHit = !bWantsPenetrate;
 
 	// visual scale
-	if (Visual)
-	{
-		const float S = FMath::Max(0.01f, Profile.ProjectileScale);
-		Visual->SetWorldScale3D(FVector(S));
-	}
+	SetVisualScale(Profile.ProjectileScale);
 
 	// cone spread around DOWN; yaw on Z would NOT affect a Z-aligned vector
 	if (Profile.bUseSpread && Profile.SpreadAngleDeg > KINDA_SMALL_NUMBER)
@@ -96,6 +95,9 @@ void ACPP_ProjectileParent::BeginPlay()
 
 	// Ensure radius matches current Stats value
 	HitSphere->SetSphereRadius(Stats.CollisionRadius);
+
+	AuthoredVisualScale = Visual->GetRelativeScale3D();
+	CacheVisualScale();
 }
 
 void ACPP_ProjectileParent::Tick(float DeltaSeconds)
@@ -117,14 +119,15 @@ void ACPP_ProjectileParent::ApplyRuntimeConfig(const FProjectileAnimResolved& In
 	if (InConfig.LoopFlipbook)   LoopFlipbook = InConfig.LoopFlipbook;
 	if (InConfig.ImpactFlipbook) ImpactFlipbook = InConfig.ImpactFlipbook;
 
-	// Copy full stat bundle
+	// Copy full stat bundle (becomes the new baseline; nothing left to restore)
 	Stats = InConfig.Stats;
+	bLaunchOverridesApplied = false;
 
 	// Apply sphere size immediately
 	HitSphere->SetSphereRadius(Stats.CollisionRadius);
 }
 
-void ACPP_ProjectileParent::FireFrom(const FVector& StartLocation, AActor* InstigatorActor)
+void ACPP_ProjectileParent::ResetForFire(const FVector& StartLocation, AActor* InstigatorActor)
 {
 	bActive = false;
 	bHasImpacted = false;
@@ -139,6 +142,26 @@ void ACPP_ProjectileParent::FireFrom(const FVector& StartLocation, AActor* Insti
 
 	SetActorLocation(StartLocation, false, nullptr, ETeleportType::TeleportPhysics);
 	PrimaryActorTick.bCanEverTick = !Stats.bUseFixedStep;
+}
+
+void ACPP_ProjectileParent::SetVisualScale(float Scale)
+{
+	const float S = FMath::Max(0.01f, Scale);
+	if (!Visual || FMath::IsNearlyEqual(S, AppliedVisualScale)) return;
+
+	Visual->SetWorldScale3D(FVector(S));
+	AppliedVisualScale = S;
+}
+
+void ACPP_ProjectileParent::CacheVisualScale()
+{
+	const FVector W = Visual ? Visual->GetComponentScale() : FVector::OneVector;
+	AppliedVisualScale = W.AllComponentsEqual(KINDA_SMALL_NUMBER) ? W.X : -1.f;
+}
+
+void ACPP_ProjectileParent::FireFrom(const FVector& StartLocation, AActor* InstigatorActor)
+{
+	ResetForFire(StartLocation, InstigatorActor);
 
 	// --- pull penetrate/scale/spread from owner’s gun component ---
 	ConfigureFromOwnerFireMode();
@@ -157,6 +180,38 @@ void ACPP_ProjectileParent::FireFromBP(const FVector& StartLocation)
 	FireFrom(StartLocation, UseInst);
 }
 
+void ACPP_ProjectileParent::FireWithLaunch(const FVector& StartLocation, AActor* InstigatorActor, const FProjectileLaunch& Launch)
+{
+	// Overrides only last for this shot; Disarm puts the row values back
+	SnapshotLaunchDefaults();
+
+	if (Launch.Speed > 0.f)       Stats.Speed = Launch.Speed;
+	if (Launch.LifeSeconds > 0.f) Stats.MaxLifeSeconds = Launch.LifeSeconds;
+	if (Launch.Damage > 0.f)      Stats.Damage = Launch.Damage;
+
+	if (Launch.SpawnFlipbook)  SpawnFlipbook = Launch.SpawnFlipbook;
+	if (Launch.LoopFlipbook)   LoopFlipbook = Launch.LoopFlipbook;
+	if (Launch.ImpactFlipbook) ImpactFlipbook = Launch.ImpactFlipbook;
+
+	ResetForFire(StartLocation, InstigatorActor);
+
+	bAutoImpactOnHit = !(Launch.bPenetrate || Stats.bPenetrate);
+	SetVisualScale(Launch.Scale);
+
+	// Direction arrives normalized from the gun's GenerateShotDirs
+	if (!Launch.Direction.IsNearlyZero()) MoveDir = Launch.Direction;
+	DownVelocity = MoveDir * FMath::Max(0.f, Stats.Speed);
+
+	ArmAndGo();
+}
+
+void ACPP_ProjectileParent::FireWithLaunchBP(const FVector& StartLocation, const FProjectileLaunch& Launch)
+{
+	AActor* UseInst = GetOwner();
+	if (!UseInst) UseInst = GetInstigator();
+	FireWithLaunch(StartLocation, UseInst, Launch);
+}
+
 // --------------------------- Movement & Timers ---------------------------
 
 void ACPP_ProjectileParent::ArmAndGo()
@@ -184,6 +239,10 @@ void ACPP_ProjectileParent::ArmAndGo()
 		);
 	}
 
+	ResolveLaneIndex();
+
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Register(this, ESpatialKind2D::Projectile);
+
 	// Movement driver
 	if (Stats.bUseFixedStep)
 	{
@@ -193,6 +252,8 @@ void ACPP_ProjectileParent::ArmAndGo()
 
 void ACPP_ProjectileParent::Disarm()
 {
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Unregister(this);
+
 	StopFixedStep();
 	GetWorldTimerManager().ClearTimer(LifeTimerHandle);
 
@@ -202,9 +263,45 @@ void ACPP_ProjectileParent::Disarm()
 	HitSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	SetActorHiddenInGame(true);
 
+	RestoreLaunchDefaults();
+
+	// back to the authored size; skipped when the last shot did not change it
+	if (Visual && !Visual->GetRelativeScale3D().Equals(AuthoredVisualScale))
+	{
+		Visual->SetRelativeScale3D(AuthoredVisualScale);
+		CacheVisualScale();
+	}
 	bActive = false;
 }
 
+void ACPP_ProjectileParent::SnapshotLaunchDefaults()
+{
+	if (bLaunchOverridesApplied) return; // keep the original row values if re-fired before returning
+
+	SavedSpeed = Stats.Speed;
+	SavedMaxLifeSeconds = Stats.MaxLifeSeconds;
+	SavedDamage = Stats.Damage;
+	bSavedAutoImpactOnHit = bAutoImpactOnHit;
+	SavedSpawnFlipbook = SpawnFlipbook;
+	SavedLoopFlipbook = LoopFlipbook;
+	SavedImpactFlipbook = ImpactFlipbook;
+	bLaunchOverridesApplied = true;
+}
+
+void ACPP_ProjectileParent::RestoreLaunchDefaults()
+{
+	if (!bLaunchOverridesApplied) return;
+
+	Stats.Speed = SavedSpeed;
+	Stats.MaxLifeSeconds = SavedMaxLifeSeconds;
+	Stats.Damage = SavedDamage;
+	bAutoImpactOnHit = bSavedAutoImpactOnHit;
+	SpawnFlipbook = SavedSpawnFlipbook;
+	LoopFlipbook = SavedLoopFlipbook;
+	ImpactFlipbook = SavedImpactFlipbook;
+	bLaunchOverridesApplied = false;
+}
+
 void ACPP_ProjectileParent::Deactivate_Internal()
 {
 	Disarm();
@@ -265,41 +362,50 @@ void ACPP_ProjectileParent::StepMove(float Dt)
 
 	const FVector Delta = DownVelocity * Dt;
 
-	FHitResult Hit;
-	const bool bMoved = RootComponent->MoveComponent(
-		Delta,
-		GetActorRotation(),
-		/*bSweep=*/true,
-		&Hit,
-		MOVECOMP_NoFlags,
-		ETeleportType::None
-	);
-
-	if (bMoved && Hit.bBlockingHit)
+	if (bUseLaneCollisionIndex && LaneIndex.IsValid())
 	{
-		OnBlock.Broadcast(this, Hit);
-
-		bool bShouldImpact = bAutoImpactOnHit;
+		if (StepMoveIndexed(Delta)) return;
+	}
+	else
+	{
+		FHitResult Hit;
+		const bool bMoved = RootComponent->MoveComponent(
+			Delta,
+			GetActorRotation(),
+			/*bSweep=*/true,
+			&Hit,
+			MOVECOMP_NoFlags,
+			ETeleportType::None
+		);
 
-		if (UPrimitiveComponent* HitComp = Hit.GetComponent())
+		if (bMoved && Hit.bBlockingHit)
 		{
-			const ECollisionChannel ObjType = HitComp->GetCollisionObjectType();
+			OnBlock.Broadcast(this, Hit);
+
+			bool bShouldImpact = bAutoImpactOnHit;
 
-			// Always impact on world geometry (platforms, walls, etc.)
-			if (ObjType == ECC_WorldStatic || ObjType == ECC_WorldDynamic)
+			if (UPrimitiveComponent* HitComp = Hit.GetComponent())
 			{
-				bShouldImpact = true;
+				const ECollisionChannel ObjType = HitComp->GetCollisionObjectType();
+
+				// Always impact on world geometry (platforms, walls, etc.)
+				if (ObjType == ECC_WorldStatic || ObjType == ECC_WorldDynamic)
+				{
+					bShouldImpact = true;
+				}
 			}
-		}
 
-		if (bShouldImpact)
-		{
-			TriggerImpactAndDeactivate(Hit);
-		}
+			if (bShouldImpact)
+			{
+				TriggerImpactAndDeactivate(Hit);
+			}
 
-		return;
+			return;
+		}
 	}
 
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->UpdateActor(this);
+
 	// Use full distance, not only |Delta.Z|
 	TraveledDistance += Delta.Size();
 	if (Stats.MaxTravelDistance > 0.f && TraveledDistance >= Stats.MaxTravelDistance)
@@ -308,6 +414,90 @@ void ACPP_ProjectileParent::StepMove(float Dt)
 	}
 }
 
+void ACPP_ProjectileParent::ResolveLaneIndex()
+{
+	if (!bUseLaneCollisionIndex || LaneIndex.IsValid() || bLaneIndexSearched) return;
+	bLaneIndexSearched = true;
+
+	if (UWorld* W = GetWorld())
+	{
+		for (TActorIterator<ALaneLevelGenerator> It(W); It; ++It)
+		{
+			LaneIndex = *It;
+			break;
+		}
+	}
+}
+
+bool ACPP_ProjectileParent::StepMoveIndexed(const FVector& Delta)
+{
+	UWorld* W = GetWorld();
+	if (!W || !HitSphere) return false;
+
+	const FVector Start = GetActorLocation();
+	const FVector End = Start + Delta;
+	const float Radius = HitSphere->GetScaledSphereRadius();
+
+	// Level geometry: analytic boxes from the generator, no physics
+	FHitResult LevelHit;
+	const bool bLevel = LaneIndex->SweepCollisionIndex(Start, End, Radius, LevelHit);
+
+	// Pawns: physics sweep with the sphere's own responses, minus world geometry,
+	// and only up to the level hit (anything further is behind the wall)
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(ProjectilePawnSweep), false, this);
+	if (AActor* Ow = GetOwner()) Q.AddIgnoredActor(Ow);
+	if (AActor* Inst = GetInstigator()) Q.AddIgnoredActor(Inst);
+
+	FCollisionResponseParams RP(HitSphere->GetCollisionResponseToChannels());
+	RP.CollisionResponse.SetResponse(ECC_WorldStatic, ECR_Ignore);
+	RP.CollisionResponse.SetResponse(ECC_WorldDynamic, ECR_Ignore);
+
+	const FVector PawnEnd = bLevel ? FVector(LevelHit.Location) : End;
+	FHitResult PawnHit;
+	const bool bPawn = AnyPawnAlong(Start, PawnEnd, Radius)
+		&& W->SweepSingleByChannel(PawnHit, Start, PawnEnd, FQuat::Identity,
+			HitSphere->GetCollisionObjectType(), FCollisionShape::MakeSphere(Radius), Q, RP);
+
+	if (bPawn && PawnHit.bBlockingHit)
+	{
+		// Same as the swept MoveComponent path: a blocking pawn stops the step either way;
+		// bAutoImpactOnHit only decides whether it also turns into an impact
+		SetActorLocation(PawnHit.Location, false, nullptr, ETeleportType::None);
+		OnBlock.Broadcast(this, PawnHit);
+		if (bAutoImpactOnHit) TriggerImpactAndDeactivate(PawnHit);
+		return true;
+	}
+
+	if (bLevel)
+	{
+		// Always impact on world geometry (platforms, walls, etc.)
+		SetActorLocation(LevelHit.Location, false, nullptr, ETeleportType::None);
+		OnBlock.Broadcast(this, LevelHit);
+		TriggerImpactAndDeactivate(LevelHit);
+		return true;
+	}
+
+	SetActorLocation(End, false, nullptr, ETeleportType::None);
+	return false;
+}
+
+bool ACPP_ProjectileParent::AnyPawnAlong(const FVector& Start, const FVector& End, float Radius)
+{
+	const UWS_SpatialHash2D* Hash = bUsePawnBroadphase ? UWS_SpatialHash2D::Get(this) : nullptr;
+	if (!Hash) return true;   // no broadphase: always sweep
+
+	const uint8 Mask = UWS_SpatialHash2D::KindBit(ESpatialKind2D::Enemy) | UWS_SpatialHash2D::KindBit(ESpatialKind2D::Player);
+	Hash->QuerySegment(Start, End, Radius + PawnBroadphaseSlackUU, PawnCandidates, Mask);
+
+	// the shooter is in the hash too but the sweep ignores it
+	const AActor* Ow = GetOwner();
+	const AActor* Inst = GetInstigator();
+	return PawnCandidates.ContainsByPredicate([Ow, Inst](const FSpatialHit2D& H)
+		{
+			return H.Actor && H.Actor != Ow && H.Actor != Inst;
+		});
+}
+
 // --------------------------- Collision / Overlap ---------------------------
 
 void ACPP_ProjectileParent::OnImpactAnimFinishTimer()
@@ -440,6 +630,9 @@ void ACPP_ProjectileParent::TriggerImpactAndDeactivate(const FHitResult& Hit)
 	if (bHasImpacted) return;
 	bHasImpacted = true;
 
+	// no longer a live bullet while the impact plays
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Unregister(this);
+
 	// Cache impact info (cast away NetQuantize)
 	LastImpactPoint = FVector(Hit.ImpactPoint);
 	LastImpactNormal = Hit.ImpactNormal.IsNearlyZero() ? FVector::UpVector : FVector(Hit.ImpactNormal);
@@ -13,6 +13,9 @@
 #include "GameFramework/MovementComponent.h"
 #include "EngineUtils.h"
 #include "Engine/Engine.h" 
+#include "Subsystem/WS_SpatialHash2D.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
+#include "Subsystem/WS_EnemyAnimRowCache.h"
 
 
 //--Helpers--
@@ -29,6 +32,37 @@ inline float LaneCenterX_Local(int32 Lane, int32 NumLanes, float LaneWidthUU)
 	return left + (idx + 0.5f) * LaneWidthUU;
 }
 
+// Segment vs box on the game plane (X/Z slab test). Entry time in [0..1] + entered face normal.
+// Starting inside a box reports nothing (the overlap path owns that case).
+static bool SegmentVsBoxXZ(float SX, float SZ, float DX, float DZ,
+	float MinX, float MaxX, float MinZ, float MaxZ, float& OutT, FVector& OutNormal)
+{
+	float tEnter = 0.f;
+	float tExit = 1.f;
+	FVector n = FVector::ZeroVector;
+
+	auto Slab = [&](float S, float D, float Lo, float Hi, const FVector& Axis) -> bool
+		{
+			if (FMath::Abs(D) < KINDA_SMALL_NUMBER) return (S >= Lo && S <= Hi);
+			const float inv = 1.f / D;
+			float t0 = (Lo - S) * inv;
+			float t1 = (Hi - S) * inv;
+			FVector face = -Axis;                    // entering through the Lo face
+			if (t0 > t1) { Swap(t0, t1); face = Axis; }
+			if (t0 > tEnter) { tEnter = t0; n = face; }
+			tExit = FMath::Min(tExit, t1);
+			return tEnter <= tExit;
+		};
+
+	if (!Slab(SX, DX, MinX, MaxX, FVector(1.f, 0.f, 0.f))) return false;
+	if (!Slab(SZ, DZ, MinZ, MaxZ, FVector(0.f, 0.f, 1.f))) return false;
+	if (n.IsZero()) return false;
+
+	OutT = tEnter;
+	OutNormal = n;
+	return true;
+}
+
 // Sets default values
 ALaneLevelGenerator::ALaneLevelGenerator()
 {
@@ -90,6 +124,8 @@ void ALaneLevelGenerator::BeginPlay()
 
 	ScaffoldLane = FMath::Clamp(NumLanes / 2, 0, NumLanes - 1);
 
+	if (UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(this)) Graph->Configure(EnemyGraphLimits);
+
 	WarmEnemyPools();
 	GetWorldTimerManager().SetTimer(PoolTimer, this, &ALaneLevelGenerator::TryEnemiesPool, RecycleInterval, true);
 }
@@ -240,6 +276,19 @@ void ALaneLevelGenerator::WarmEnemyPools()
 {
 	UWorld* W = GetWorld(); if (!W) return;
 
+	// Start each pool class's anim row once; the pooled instances below join those loads
+	UWS_EnemyAnimRowCache* AnimCache = UWS_EnemyAnimRowCache::Get(this);
+	if (AnimCache)
+	{
+		for (const TSubclassOf<ACPP_EnemyParent>& Cls : { WalkerEnemyClass, WalkerAltEnemyClass, FlyerEnemyClass })
+		{
+			if (const ACPP_EnemyParent* CDO = Cls ? Cls->GetDefaultObject<ACPP_EnemyParent>() : nullptr)
+			{
+				AnimCache->Preload(CDO->GetAnimationDataTable(), CDO->GetAnimationRowName());
+			}
+		}
+	}
+
 	auto SpawnIntoPool = [&](TArray<TObjectPtr<ACPP_EnemyParent>>& Pool,
 		TSubclassOf<ACPP_EnemyParent> Cls, int32 Count)
 		{
@@ -269,6 +318,9 @@ void ALaneLevelGenerator::WarmEnemyPools()
 
 	// Flyers unchanged
 	SpawnIntoPool(FlyerPool, FlyerEnemyClass, PoolSize_Flyer);
+
+	// Pools are warm only once every instance has its anims: borrowing never waits on a load
+	if (AnimCache) AnimCache->FlushPending();
 }
 
 ACPP_EnemyParent* ALaneLevelGenerator::BorrowFromPool(TArray<TObjectPtr<ACPP_EnemyParent>>& Pool, TSubclassOf<ACPP_EnemyParent> Cls, int32 PoolCap)
@@ -277,7 +329,6 @@ ACPP_EnemyParent* ALaneLevelGenerator::BorrowFromPool(TArray<TObjectPtr<ACPP_Ene
 	int32& rr = (&Pool == &WalkerPool) ? NextWalkerIdx : NextFlyerIdx;
 
 	const int32 N = Pool.Num();
-	const float Now = GetWorld() ? GetWorld()->TimeSeconds : 0.f;
 
 	// First pass: pick only strictly POOLED enemies that also passed MinReuseDelay
 	for (int32 t = 0; t < N; ++t)
@@ -286,13 +337,10 @@ ACPP_EnemyParent* ALaneLevelGenerator::BorrowFromPool(TArray<TObjectPtr<ACPP_Ene
 		ACPP_EnemyParent* E = Pool[idx];
 		if (!E) continue;
 
-		// Only reuse if truly pooled (never pick Dying/Active)
-		if (E->GetLifeState() != EEnemyLifeState::Pooled) continue;
-
-		// Optional: honor per-enemy reuse cooldown (from our earlier patch)
-		// If you didn’t add these fields, you can remove the two lines below.
-		const float sincePool = Now - E->PooledAtTime;
-		if (sincePool < E->MinReuseDelay) continue;
+		// Only reuse if truly pooled (never pick Dying/Active or one already queued to activate)
+		// and rested for MinReuseDelay, so a fresh pick never has to wait in the queue
+		if (E->GetLifeState() != EEnemyLifeState::Pooled || E->IsPendingActivate()) continue;
+		if (!E->IsReuseDelayElapsed()) continue;
 
 		// Fairness: advance the cursor past this pick
 		rr = (idx + 1) % FMath::Max(N, 1);
@@ -381,11 +429,11 @@ void ALaneLevelGenerator::ShiftAllByWorldZ(float DeltaZ)
 	const FVector worldOffset(0.f, 0.f, DeltaZ);
 	const float   deltaLocalY = GetActorTransform().InverseTransformVector(worldOffset).Y;
 
-	// --- carry ALL pooled enemies (cheap, no misses)
+	// --- carry ALL pooled enemies (cheap, no misses), queued activation targets included
 	for (ACPP_EnemyParent* E : WalkerPool)
-		if (E) E->AddActorWorldOffset(worldOffset, false, nullptr, ETeleportType::TeleportPhysics);
+		if (E) { E->AddActorWorldOffset(worldOffset, false, nullptr, ETeleportType::TeleportPhysics); E->RebasePendingZ(DeltaZ); }
 	for (ACPP_EnemyParent* E : FlyerPool)
-		if (E) E->AddActorWorldOffset(worldOffset, false, nullptr, ETeleportType::TeleportPhysics);
+		if (E) { E->AddActorWorldOffset(worldOffset, false, nullptr, ETeleportType::TeleportPhysics); E->RebasePendingZ(DeltaZ); }
 
 	// 1) player
 	if (PlayerRef)
@@ -419,8 +467,13 @@ void ALaneLevelGenerator::ShiftAllByWorldZ(float DeltaZ)
 				A->AddActorWorldOffset(worldOffset, false, nullptr, ETeleportType::TeleportPhysics);
 
 		Row.LocalY += deltaLocalY;
+		Row.Collision.ShiftZ(DeltaZ);
 	}
 
+	// 3b) spatial hash follows everything above in one shift
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->RebaseZ(DeltaZ);
+	if (UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(this)) Graph->RebaseZ(DeltaZ);
+
 	// 4) cursors
 	CursorLocalY += deltaLocalY;
 	NextWalkerLocalY += deltaLocalY;
@@ -687,6 +740,7 @@ void ALaneLevelGenerator::GenerateScaffoldSegment()
 
 			// Spawn rows of platforms at this LocalY
 			SpawnRuns(Runs, Row.LocalY, Row.Actors);
+			BuildRowCollision(Row);
 		}
 		else if (!bGen_DryRun_NoSpawn && bGen_SkipRuns)
 		{
@@ -774,7 +828,11 @@ void ALaneLevelGenerator::GenerateScaffoldSegment_Simple()
 			// build the collider-only strip (fallback path); tiling path also calls ApplyCollisionSizing
 			Plat->BuildDebugFallback(tiles);
 			row.Actors.Add(Plat);
+
+			// DespawnRow removes row actors from the graph, so fallback rows go in like SpawnRuns strips
+			if (UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(this)) Graph->AddStrip(Plat);
 		}
+		BuildRowCollision(row);
 	}
 
 	LiveRows.Add(row);
@@ -1101,12 +1159,127 @@ void ALaneLevelGenerator::BuildRunsFromMask(uint16 Mask, int32 InScaffoldLane, T
 
 void ALaneLevelGenerator::DespawnRow(FRowBit& Row)
 {
+	UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this);
+	UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(this);
 	for (TWeakObjectPtr<APlatformStrip>& W : Row.Actors)
 		if (APlatformStrip* A = W.Get())
+		{
+			if (Hash) Hash->Unregister(A);
+			if (Graph) Graph->RemoveStrip(A);
 			A->Destroy();
+		}
 	Row.Actors.Empty();
 }
 
+void ALaneLevelGenerator::BuildRowCollision(FRowBit& Row) const
+{
+	FLaneRowCollision& C = Row.Collision;
+	C = FLaneRowCollision();
+
+	auto AddSpan = [&C](APlatformStrip* P, const FBox& B, int32 Tile)
+		{
+			if (!B.IsValid) return;
+			FLaneCollisionSpan& S = C.Spans.AddDefaulted_GetRef();
+			S.MinX = B.Min.X; S.MaxX = B.Max.X;
+			S.MinZ = B.Min.Z; S.MaxZ = B.Max.Z;
+			S.Strip = P;
+			S.TileIndex = Tile;
+			C.MinZ = FMath::Min(C.MinZ, S.MinZ);
+			C.MaxZ = FMath::Max(C.MaxZ, S.MaxZ);
+		};
+
+	for (const TWeakObjectPtr<APlatformStrip>& W : Row.Actors)
+	{
+		APlatformStrip* P = W.Get();
+		if (!P) continue;
+
+		// strips built without tile bookkeeping: one box for the whole collider
+		const int32 count = P->GetBuiltTileCount();
+		if (count <= 0)
+		{
+			AddSpan(P, P->GetCollisionWorldBox(), INDEX_NONE);
+			continue;
+		}
+
+		// merge runs of solid tiles; breakables stay one span per tile
+		int32 i = 0;
+		while (i < count)
+		{
+			if (P->IsTileBreakable(i))
+			{
+				AddSpan(P, P->GetTileSpanWorldBox(i, i), i);
+				++i;
+				continue;
+			}
+			int32 j = i;
+			while (j + 1 < count && !P->IsTileBreakable(j + 1)) ++j;
+			AddSpan(P, P->GetTileSpanWorldBox(i, j), INDEX_NONE);
+			i = j + 1;
+		}
+	}
+}
+
+bool ALaneLevelGenerator::SweepCollisionIndex(const FVector& Start, const FVector& End, float Radius, FHitResult& OutHit) const
+{
+	const float R = FMath::Max(Radius, 0.f);
+	const float DX = End.X - Start.X;
+	const float DZ = End.Z - Start.Z;
+	const float segMinZ = FMath::Min(Start.Z, End.Z) - R;
+	const float segMaxZ = FMath::Max(Start.Z, End.Z) + R;
+
+	float bestT = 2.f;
+	FVector bestN = FVector::UpVector;
+	AActor* bestActor = nullptr;
+	UPrimitiveComponent* bestComp = nullptr;
+	int32 bestItem = INDEX_NONE;
+
+	// strips: rows outside the segment's Z band cost one compare
+	for (const FRowBit& Row : LiveRows)
+	{
+		const FLaneRowCollision& C = Row.Collision;
+		if (C.Spans.Num() == 0 || C.MaxZ + R < segMinZ || C.MinZ - R > segMaxZ) continue;
+
+		for (const FLaneCollisionSpan& S : C.Spans)
+		{
+			APlatformStrip* P = S.Strip.Get();
+			if (!P) continue;
+			if (S.TileIndex != INDEX_NONE && P->IsTileBroken(S.TileIndex)) continue;
+
+			float t = 0.f; FVector n;
+			if (SegmentVsBoxXZ(Start.X, Start.Z, DX, DZ, S.MinX - R, S.MaxX + R, S.MinZ - R, S.MaxZ + R, t, n) && t < bestT)
+			{
+				bestT = t; bestN = n; bestActor = P; bestComp = nullptr; bestItem = S.TileIndex;
+			}
+		}
+	}
+
+	// side walls (only while their blockers are on)
+	for (UBoxComponent* Wall : { LeftWall, RightWall })
+	{
+		if (!Wall || !Wall->IsCollisionEnabled()) continue;
+		const FBox B = Wall->Bounds.GetBox();
+
+		float t = 0.f; FVector n;
+		if (SegmentVsBoxXZ(Start.X, Start.Z, DX, DZ, B.Min.X - R, B.Max.X + R, B.Min.Z - R, B.Max.Z + R, t, n) && t < bestT)
+		{
+			bestT = t; bestN = n; bestActor = const_cast<ALaneLevelGenerator*>(this); bestComp = Wall; bestItem = INDEX_NONE;
+		}
+	}
+
+	if (bestT > 1.f) return false;
+
+	const FVector loc = Start + (End - Start) * bestT;
+	OutHit = FHitResult(bestActor, bestComp, loc, bestN);
+	OutHit.bBlockingHit = true;
+	OutHit.Time = bestT;
+	OutHit.Distance = FVector::Dist(Start, loc);
+	OutHit.ImpactPoint = loc - bestN * R;
+	OutHit.TraceStart = Start;
+	OutHit.TraceEnd = End;
+	OutHit.Item = bestItem;
+	return true;
+}
+
 void ALaneLevelGenerator::ApplyHazardsToRuns(uint16 MaskAbove, uint16 MaskThis, TArray<FRowRun>& Runs) const
 {
 	const float pBreak = BreakableRatio();   // your curve
@@ -1533,6 +1706,16 @@ void ALaneLevelGenerator::SpawnRuns(const TArray<FRowRun>& Runs,
 			Plat->SetActorLocation(newWorld, false);
 		}
 
+		if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this))
+		{
+			const int32 builtTiles = Plat->GetBuiltTileCount();
+			Hash->RegisterBox(Plat, ESpatialKind2D::Strip,
+				builtTiles > 0 ? Plat->GetTileSpanWorldBox(0, builtTiles - 1) : Plat->GetCollisionWorldBox());
+		}
+
+		// final position is known here; breaks keep it in sync through the strip's OnSpansChanged
+		if (UWS_PlatformGraph2D* Graph = UWS_PlatformGraph2D::Get(this)) Graph->AddStrip(Plat);
+
 		TrySpawnEnemyOnStrip(Plat, P.TilesWide, P.Kind);
 
 		// Label
@@ -1562,7 +1745,7 @@ void ALaneLevelGenerator::TrySpawnEnemyOnStrip(APlatformStrip* Plat, int32 Tiles
 			int32 n = 0;
 			for (ACPP_EnemyParent* E : Pool)
 			{
-				if (E && E->IsActive()) { ++n; }
+				if (E && (E->IsActive() || E->IsPendingActivate())) { ++n; }
 			}
 			return n;
 		};
@@ -1608,7 +1791,7 @@ void ALaneLevelGenerator::TrySpawnEnemyOnStrip(APlatformStrip* Plat, int32 Tiles
 			{
 				FVector Spawn = Plat->GetActorLocation();
 				Spawn.Z = PlatformTopZ + WalkerHalfZ + WalkerHoverZ;
-				W->ActivateFromPool(Spawn);
+				W->RequestActivateFromPool(Spawn, Plat);
 				NextWalkerLocalY = localY + WalkerMinDYBetweenSpawnsUU;
 			}
 		}
@@ -1628,7 +1811,7 @@ void ALaneLevelGenerator::TrySpawnEnemyOnStrip(APlatformStrip* Plat, int32 Tiles
 			{
 				FVector Spawn = Plat->GetActorLocation();
 				Spawn.Z = PlatformTopZ + WalkerHalfZ + WalkerHoverZ;
-				WB->ActivateFromPool(Spawn);
+				WB->RequestActivateFromPool(Spawn, Plat);
 				NextWalkerLocalY = localY + WalkerMinDYBetweenSpawnsUU;
 			}
 		}
@@ -1646,7 +1829,7 @@ void ALaneLevelGenerator::TrySpawnEnemyOnStrip(APlatformStrip* Plat, int32 Tiles
 			{
 				FVector Spawn = Plat->GetActorLocation();
 				Spawn.Z = PlatformTopZ + FlyerHalfZ + FlyerSpawnAboveZ;
-				F->ActivateFromPool(Spawn);
+				F->RequestActivateFromPool(Spawn);
 				NextFlyerLocalY = localY + FlyerMinDYBetweenSpawnsUU;
 			}
 		}
@@ -1704,8 +1887,8 @@ void ALaneLevelGenerator::PauseAndFlush(bool bAlsoWalls, bool bDisableWallBlocke
 	NextFlyerLocalY = -FLT_MAX;
 
 	// optional hard flush of currently active enemies
-	for (TObjectPtr<ACPP_EnemyParent>& P : WalkerPool) if (P && P->IsActive()) P->DeactivateToPool();
-	for (TObjectPtr<ACPP_EnemyParent>& P : FlyerPool)  if (P && P->IsActive()) P->DeactivateToPool();
+	for (TObjectPtr<ACPP_EnemyParent>& P : WalkerPool) if (P && (P->IsActive() || P->IsPendingActivate())) P->DeactivateToPool();
+	for (TObjectPtr<ACPP_EnemyParent>& P : FlyerPool)  if (P && (P->IsActive() || P->IsPendingActivate())) P->DeactivateToPool();
 }
 
 void ALaneLevelGenerator::ResumeSpawning(float StartDelaySeconds, float StartBelowPlayerScreens)
@@ -484,6 +484,8 @@ void APlatformStrip::BreakTile(int32 TileIndex)
         SB->SetCollisionResponseToChannel(ProjectileObjectChannel, ECR_Ignore);        // player/enemies fall through
         SB->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);        // walkers “see” a hole/ledge here
     }
+
+    OnSpansChanged.Broadcast(this);
 }
 
 float APlatformStrip::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
@@ -542,6 +544,7 @@ void APlatformStrip::BreakInRadius(const FVector& WorldCenter, float RadiusUU)
         if (SegmentBoxes.Num()==0 && Box)
             Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
         RebuildSegmentCollision();
+        OnSpansChanged.Broadcast(this);
     }
 }
 
@@ -721,6 +724,81 @@ bool APlatformStrip::GetRandomSpawnPoint(int32& OutTileIdx, FVector& OutWorld, f
     return true;
 }
 
+FBox APlatformStrip::GetTileSpanWorldBox(int32 FirstTile, int32 LastTile) const
+{
+    if (BuiltCount <= 0 || !Box) return FBox(ForceInit);
+    FirstTile = FMath::Clamp(FirstTile, 0, BuiltCount - 1);
+    LastTile = FMath::Clamp(LastTile, FirstTile, BuiltCount - 1);
+
+    // same Y/Z sizing + anchor as the big box (segments copy it too)
+    const FVector ext = Box->GetUnscaledBoxExtent();
+    const float   centerY = Box->GetRelativeLocation().Y;
+
+    const float x0 = BuiltLeftX + (float(FirstTile) - 0.5f) * BuiltTileW;
+    const float x1 = BuiltLeftX + (float(LastTile) + 0.5f) * BuiltTileW;
+
+    const FBox local(FVector(x0, centerY - ext.Y, -ext.Z), FVector(x1, centerY + ext.Y, ext.Z));
+    return local.TransformBy(GetActorTransform());
+}
+
+FBox APlatformStrip::GetCollisionWorldBox() const
+{
+    if (!Box) return FBox(ForceInit);
+    return Box->Bounds.GetBox();
+}
+
+bool APlatformStrip::GetSolidSpanAtWorldX(float WorldX, float& OutMinX, float& OutMaxX, float& OutTopZ) const
+{
+    if (BuiltCount <= 0 || BuiltTileW <= KINDA_SMALL_NUMBER)
+    {
+        const FBox B = GetCollisionWorldBox();
+        if (!B.IsValid || WorldX < B.Min.X || WorldX > B.Max.X) return false;
+        OutMinX = B.Min.X; OutMaxX = B.Max.X; OutTopZ = B.Max.Z;
+        return true;
+    }
+
+    // same rule as RebuildSegmentCollision: breakables are solid until actually broken
+    auto solidAt = [&](int32 i) { return !(IsTileBreakable(i) && IsTileBroken(i)); };
+
+    const FVector L = GetActorTransform().InverseTransformPosition(FVector(WorldX, GetActorLocation().Y, GetActorLocation().Z));
+    const float   t = (L.X - BuiltLeftX) / BuiltTileW + 0.5f;
+    if (t < 0.f || t >= float(BuiltCount)) return false;
+
+    const int32 tile = FMath::FloorToInt(t);
+    if (!solidAt(tile)) return false;
+
+    int32 lo = tile, hi = tile;
+    while (lo > 0 && solidAt(lo - 1)) --lo;
+    while (hi < BuiltCount - 1 && solidAt(hi + 1)) ++hi;
+
+    const FBox B = GetTileSpanWorldBox(lo, hi);
+    if (!B.IsValid) return false;
+    OutMinX = B.Min.X; OutMaxX = B.Max.X; OutTopZ = B.Max.Z;
+    return true;
+}
+
+void APlatformStrip::GetSolidSpansWorld(TArray<FBox>& OutSpans) const
+{
+    OutSpans.Reset();
+
+    if (BuiltCount <= 0 || BuiltTileW <= KINDA_SMALL_NUMBER)
+    {
+        const FBox B = GetCollisionWorldBox();
+        if (B.IsValid) OutSpans.Add(B);
+        return;
+    }
 
+    auto solidAt = [&](int32 i) { return !(IsTileBreakable(i) && IsTileBroken(i)); };
 
+    int32 i = 0;
+    while (i < BuiltCount)
+    {
+        if (!solidAt(i)) { ++i; continue; }
+        int32 j = i;
+        while (j + 1 < BuiltCount && solidAt(j + 1)) ++j;   // [i..j] solid
 
+        const FBox B = GetTileSpanWorldBox(i, j);
+        if (B.IsValid) OutSpans.Add(B);
+        i = j + 1;
+    }
+}
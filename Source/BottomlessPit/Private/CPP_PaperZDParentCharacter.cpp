@@ -6,9 +6,12 @@
 #include "GameFramework/Controller.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Components/Movement2DComponent.h"
+#include "Subsystem/WS_SpatialHash2D.h"
 
 
-ACPP_PaperZDParentCharacter::ACPP_PaperZDParentCharacter()
+ACPP_PaperZDParentCharacter::ACPP_PaperZDParentCharacter(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UMovement2DComponent>(ACharacter::CharacterMovementComponentName))
 {
     PrimaryActorTick.bCanEverTick = true; // Enable Tick
     bLookingBack = false;
@@ -25,6 +28,15 @@ void ACPP_PaperZDParentCharacter::BeginPlay()
 
     MyMovementComp = GetCharacterMovement();
     MyControllerComp = GetController();
+
+    if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Register(this, ESpatialKind2D::Player);
+}
+
+void ACPP_PaperZDParentCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Unregister(this);
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void ACPP_PaperZDParentCharacter::ChangeMovementState(EE_PlayerMovementState NewState)
@@ -33,6 +45,9 @@ void ACPP_PaperZDParentCharacter::ChangeMovementState(EE_PlayerMovementState New
     const EE_PlayerMovementState Old = CurrentMovementState;
     CurrentMovementState = NewState;
 
+    // a walk pending from before this change must not override it (Jump, Dash, Slide, Idle, ...)
+    if (NewState != EE_PlayerMovementState::Walk) CancelWalkCommit();
+
     // clear any timers if you keep them here (IdleConfirm etc.), or leave to child
     OnMovementStateChanged.Broadcast(Old, CurrentMovementState);
     OnMovementStateChangedNative(Old, CurrentMovementState);
@@ -41,11 +56,8 @@ void ACPP_PaperZDParentCharacter::ChangeMovementState(EE_PlayerMovementState New
 void ACPP_PaperZDParentCharacter::ScheduleIdleConfirm()
 {
     if (!IsGrounded()) return; // never idle mid-air
-    ClearIdleConfirmTimer();
-    GetWorldTimerManager().SetTimer(
-        IdleConfirmTimer, this, &ACPP_PaperZDParentCharacter::ConfirmIdle,
-        IdleConfirmDelay, false
-    );
+    CancelWalkCommit();
+    IdleConfirmAt = GetWorld()->GetTimeSeconds() + IdleConfirmDelay;
 }
 
 void ACPP_PaperZDParentCharacter::ConfirmIdle()
@@ -56,7 +68,35 @@ void ACPP_PaperZDParentCharacter::ConfirmIdle()
 
 void ACPP_PaperZDParentCharacter::ClearIdleConfirmTimer()
 {
-    GetWorldTimerManager().ClearTimer(IdleConfirmTimer);
+    IdleConfirmAt = -1.0;
+}
+
+void ACPP_PaperZDParentCharacter::RequestWalk()
+{
+    IdleConfirmAt = -1.0;
+    if (WalkIntentSince < 0.0) WalkIntentSince = GetWorld()->GetTimeSeconds(); // keep the first stamp while held
+}
+
+void ACPP_PaperZDParentCharacter::EvaluateLocomotion()
+{
+    if (IdleConfirmAt < 0.0 && WalkIntentSince < 0.0) return;
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    if (WalkIntentSince >= 0.0 && Now - WalkIntentSince >= WalkCommitDelay)
+    {
+        WalkIntentSince = -1.0;
+        if (IsGrounded() && CurrentMovementState == EE_PlayerMovementState::Idle)
+        {
+            ChangeMovementState(EE_PlayerMovementState::Walk);
+        }
+    }
+
+    if (IdleConfirmAt >= 0.0 && Now >= IdleConfirmAt)
+    {
+        IdleConfirmAt = -1.0;
+        ConfirmIdle();
+    }
 }
 
 void ACPP_PaperZDParentCharacter::HandleAxisIntent(int32 CombinedAxis)
@@ -65,10 +105,13 @@ void ACPP_PaperZDParentCharacter::HandleAxisIntent(int32 CombinedAxis)
     if (CombinedAxis != 0)
     {
         // User is providing directional intent
-        ClearIdleConfirmTimer();
         if (IsGrounded() && CurrentMovementState != EE_PlayerMovementState::Walk)
         {
-            ChangeMovementState(EE_PlayerMovementState::Walk);
+            RequestWalk();
+        }
+        else
+        {
+            ClearIdleConfirmTimer();
         }
     }
     else
@@ -100,6 +143,11 @@ void ACPP_PaperZDParentCharacter::Tick(float DeltaTime)
 
     
     Super::Tick(DeltaTime);
+
+    if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->UpdateActor(this);
+
+    EvaluateLocomotion();
+
     if (UseControlRotation) {
 
         if (CustomTimeDilation <= 0.01f || !MyMovementComp)
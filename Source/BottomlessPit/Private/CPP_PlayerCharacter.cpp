@@ -16,6 +16,7 @@
 #include "PaperZDAnimInstance.h"
 #include "PaperFlipbookComponent.h"
 #include "GameFramework/PlayerController.h"
+#include "Game/CPP_PC_BottomlessPit.h"
 
 ACPP_PlayerCharacter::ACPP_PlayerCharacter()
 {
@@ -185,7 +186,15 @@ void ACPP_PlayerCharacter::UpdateRotationBasedOnCursor()
     FVector2D MousePos;
     FVector2D CharScreenPos;
 
-    if (!CachedPlayerController->GetMousePosition(MousePos.X, MousePos.Y) ||
+    // Shared per-frame sample from our controller (no second mouse/screen projection)
+    if (const ACPP_PC_BottomlessPit* BlpPC = Cast<ACPP_PC_BottomlessPit>(CachedPlayerController))
+    {
+        const FCursorSample2D& Cursor = BlpPC->GetCursorSample();
+        if (!Cursor.bValid || !Cursor.bPawnOnScreen) return;
+        MousePos = Cursor.MouseScreen;
+        CharScreenPos = Cursor.PawnScreen;
+    }
+    else if (!CachedPlayerController->GetMousePosition(MousePos.X, MousePos.Y) ||
         !CachedPlayerController->ProjectWorldLocationToScreen(
             GetActorLocation(),  // Using simple actor location instead of capsule
             CharScreenPos,
@@ -367,6 +376,15 @@ bool ACPP_PlayerCharacter::GetCursorWorldOnCharacterPlane(FVector& OutWorld) con
     APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
     if (!PC) return false;
 
+    // Our controller already projected the cursor onto the pawn plane this frame
+    if (const ACPP_PC_BottomlessPit* BlpPC = Cast<ACPP_PC_BottomlessPit>(PC))
+    {
+        const FCursorSample2D& Cursor = BlpPC->GetCursorSample();
+        if (!Cursor.bValid) return false;
+        OutWorld = Cursor.WorldOnPlane;
+        return true;
+    }
+
     FVector WL, WD;
     if (!PC->DeprojectMousePositionToWorld(WL, WD))
         return false;
@@ -511,6 +529,7 @@ void ACPP_PlayerCharacter::OnJumpStarted(const FInputActionValue& Value)
         bIsFalling = true;
         OnJumpStartedEvent.Broadcast(GetScalar01(Value));
         ClearIdleConfirmTimer();
+        CancelWalkCommit();
         // TODO: Call Jump(); or custom jump logic
         CurrentJumpCount = CurrentJumpCount + 1 ;
         Jump();
@@ -629,10 +648,13 @@ void ACPP_PlayerCharacter::HandleMove(bool bIsLeftKey, ETriggerEvent Phase, cons
     // promote to Walk only if truly grounded and not currently an air state
     if (Combined != 0 && IsGrounded() && !RR_IsAirState(CurrentMovementState))
     {
-        ClearIdleConfirmTimer();
         if (CurrentMovementState != EE_PlayerMovementState::Walk)
         {
-            ChangeMovementState(EE_PlayerMovementState::Walk);
+            RequestWalk(); // committed by EvaluateLocomotion after WalkCommitDelay
+        }
+        else
+        {
+            ClearIdleConfirmTimer();
         }
     }
 
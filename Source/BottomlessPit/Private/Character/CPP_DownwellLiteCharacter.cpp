@@ -8,6 +8,8 @@
 #include "Components/BoxComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Components/Movement2DComponent.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogStomp, Log, All);
 
@@ -55,6 +57,7 @@ void ACPP_DownwellLiteCharacter::JumpFunction()
     else if (CurrentAmmoCount >= 0) {
         bIsFalling = true;
         ClearIdleConfirmTimer();
+        CancelWalkCommit();
         if (IsGrounded())
         {
             GetCharacterMovement()->JumpZVelocity = JumpHeight;
@@ -78,22 +81,10 @@ void ACPP_DownwellLiteCharacter::JumpFunction()
     }
 }
 
-void ACPP_DownwellLiteCharacter::StompMonitorTick()
+void ACPP_DownwellLiteCharacter::HandleFallSpeedReached()
 {
-    const float Vz = GetVelocity().Z;
-    const bool bFallingFast = (Vz < -StompMinDownSpeed);
-
-   /* UE_LOG(LogStomp, Verbose, TEXT("[Stomp] MonitorTick: Vz=%.1f  Min=%.1f  FallingFast=%s"),
-        Vz, StompMinDownSpeed, bFallingFast ? TEXT("YES") : TEXT("NO"));*/
-
-    if (!bFallingFast) return;
-
-    //UE_LOG(LogStomp, Log, TEXT("[Stomp] Falling fast detected -> BeginStompActive()"));
+    // Falling fast: latch ON until Landed (the movement component dropped its watch)
     BeginStompActive();
-
-    // Stop monitoring; we’re latched ON now until Landed.
-    GetWorldTimerManager().ClearTimer(Timer_StompMonitor);
-    //UE_LOG(LogStomp, Log, TEXT("[Stomp] Monitor CLEARED (latched active)"));
 }
 
 void ACPP_DownwellLiteCharacter::BeginStompActive()
@@ -101,33 +92,38 @@ void ACPP_DownwellLiteCharacter::BeginStompActive()
     if (bStompActive) return; // already latched
 
     bStompActive = true;
-    SetStompCollisionEnabled(true);
+    StompedThisFall.Reset();
 
     //UE_LOG(LogStomp, Log, TEXT("[Stomp] ACTIVATED (latched until Landed)"));
 }
 
-void ACPP_DownwellLiteCharacter::SetStompCollisionEnabled(bool bEnabled)
+void ACPP_DownwellLiteCharacter::HandleFallStep(const FVector& From, const FVector& To)
 {
-    if (!StompSensor) return;
+    if (!bStompActive) return;
 
-    if (bEnabled)
-    {
-        StompSensor->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-        StompSensor->SetGenerateOverlapEvents(true);
-        StompSensor->SetCollisionResponseToAllChannels(ECR_Ignore);
-        StompSensor->SetCollisionResponseToChannel(EnemyChannel, ECR_Block);
+    // sweep the sensor box (same extent/offset the overlap sensor used) over this step's fall
+    const FVector SensorOffset(0.f, 0.f, StompSensorOffsetZ);
+    const FCollisionShape Box = FCollisionShape::MakeBox(StompSensorExtent);
 
-        StompSensor->SetBoxExtent(StompSensorExtent);
-        StompSensor->SetRelativeLocation(FVector(0.f, 0.f, StompSensorOffsetZ));
+    // everything reports as overlap so the floor / walls (the channel blocks by default) can't end the sweep early
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(StompSweep), false, this);
+    FCollisionResponseParams Responses;
+    Responses.CollisionResponse.SetAllChannels(ECR_Overlap);
+    TArray<FHitResult> Hits;
+    GetWorld()->SweepMultiByChannel(Hits, From + SensorOffset, To + SensorOffset, FQuat::Identity, EnemyChannel, Box, Params, Responses);
 
-        /*UE_LOG(LogStomp, Verbose, TEXT("[Stomp] Sensor ENABLED (extent=%s, offsetZ=%.1f)"),
-            *StompSensorExtent.ToString(), StompSensorOffsetZ);*/
-    }
-    else
+    for (const FHitResult& Hit : Hits)
     {
-        StompSensor->SetGenerateOverlapEvents(false);
-        StompSensor->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-        //UE_LOG(LogStomp, Verbose, TEXT("[Stomp] Sensor DISABLED"));
+        // the channel also blocks on level geometry; only enemies we swept into count
+        ACPP_EnemyParent* Enemy = Cast<ACPP_EnemyParent>(Hit.GetActor());
+        const UPrimitiveComponent* Comp = Hit.GetComponent();
+        if (!Enemy || Hit.bStartPenetrating || StompedThisFall.Contains(Enemy)) continue;
+        if (!Comp || Comp->GetCollisionResponseToChannel(EnemyChannel) != ECR_Block) continue;
+
+        StompedThisFall.Add(Enemy);
+        LastStompTime = GetWorld()->GetTimeSeconds();
+        //UE_LOG(LogStomp, Verbose, TEXT("[Stomp] Hit %s"), *GetNameSafe(Enemy));
+        CustomEventOnStomp(Enemy, Hit);
     }
 }
 
@@ -154,9 +150,10 @@ void ACPP_DownwellLiteCharacter::SetMoveAxis(float InAxis)
                     {
                         if (!bAxisZero)
                             {
-                                ClearIdleConfirmTimer();
                                 if (CurrentMovementState != EE_PlayerMovementState::Walk)
-                                ChangeMovementState(EE_PlayerMovementState::Walk);
+                                RequestWalk();
+                                else
+                                ClearIdleConfirmTimer();
                             }
                         else if (!bWasZero) // only when transitioning to zero
                             {
@@ -166,6 +163,7 @@ void ACPP_DownwellLiteCharacter::SetMoveAxis(float InAxis)
                 else
                     {
                         ClearIdleConfirmTimer();
+                        CancelWalkCommit();
                         if (bJumpInput && bIsFalling && CurrentMovementState != EE_PlayerMovementState::Jump)
                         ChangeMovementState(EE_PlayerMovementState::Jump);
                     }
@@ -194,6 +192,15 @@ void ACPP_DownwellLiteCharacter::CustomEventOnLanded_Implementation(FHitResult H
     //UE_LOG(LogTemp, Warning, TEXT("CustomEventOnLanded called in C++"));
 }
 
+void ACPP_DownwellLiteCharacter::CustomEventOnStomp_Implementation(AActor* Enemy, FHitResult HitResult)
+{
+    // Native stomp damage; a BP override replaces it unless it calls the parent
+    if (Enemy && StompDamage > 0.f)
+    {
+        UGameplayStatics::ApplyDamage(Enemy, StompDamage, GetController(), this, nullptr);
+    }
+}
+
 void ACPP_DownwellLiteCharacter::Landed(const FHitResult& Hit)
 {
     Super::Landed(Hit);
@@ -219,7 +226,11 @@ void ACPP_DownwellLiteCharacter::BeginPlay()
 {
     Super::BeginPlay();
 
-
+    if (UMovement2DComponent* Move2D = Cast<UMovement2DComponent>(GetCharacterMovement()))
+    {
+        Move2D->OnFallSpeedReached.AddUObject(this, &ACPP_DownwellLiteCharacter::HandleFallSpeedReached);
+        Move2D->OnFallStep.AddUObject(this, &ACPP_DownwellLiteCharacter::HandleFallStep);
+    }
 }
 
 void ACPP_DownwellLiteCharacter::InputJumpReleased()
@@ -237,6 +248,9 @@ void ACPP_DownwellLiteCharacter::InputDownPressed()
         OnDownSmashStartedEvent.Broadcast(GetScalar01(1));
         //UE_LOG(LogTemp, Warning, TEXT("Smash Ground"));
         IsSmashingDown = true;
+
+        // no-op unless the movement component has a SmashDownSpeed set
+        if (UMovement2DComponent* Move2D = Cast<UMovement2DComponent>(GetCharacterMovement())) Move2D->StartSmashDown();
     }
 }
 
@@ -249,41 +263,21 @@ void ACPP_DownwellLiteCharacter::StartStompWatch()
 {
     //UE_LOG(LogStomp, Log, TEXT("[Stomp] StartStompWatch()"));
 
+    UMovement2DComponent* Move2D = Cast<UMovement2DComponent>(GetCharacterMovement());
+    if (!Move2D) return;
+
     // Already armed or already active? do nothing.
-    auto& T = GetWorldTimerManager();
-    if (bStompActive || T.IsTimerActive(Timer_StompMonitor))
-    {
-        /*UE_LOG(LogStomp, Log, TEXT("[Stomp] Ignored: already %s"),
-            bStompActive ? TEXT("ACTIVE") : TEXT("ARMING"));*/
-        return;
-    }
+    if (bStompActive || Move2D->IsWatchingFallSpeed()) return;
 
-    // Start arming monitor
-    T.SetTimer(Timer_StompMonitor, this, &ACPP_DownwellLiteCharacter::StompMonitorTick,
-        StompMonitorInterval, true);
-    //UE_LOG(LogStomp, Log, TEXT("[Stomp] Monitor STARTED @ %.3fs"), StompMonitorInterval);
+    // Arm: the movement update raises HandleFallSpeedReached once Vz < -StompMinDownSpeed
+    Move2D->WatchFallSpeed(StompMinDownSpeed);
 }
 
 void ACPP_DownwellLiteCharacter::StopStompWatch()
 {
-    auto& T = GetWorldTimerManager();
+    if (UMovement2DComponent* Move2D = Cast<UMovement2DComponent>(GetCharacterMovement())) Move2D->ClearFallWatch();
 
-    const bool bMon = T.IsTimerActive(Timer_StompMonitor);
-    T.ClearTimer(Timer_StompMonitor);
-
-    if (bStompActive)
-    {
-        bStompActive = false;
-        SetStompCollisionEnabled(false);
-        //UE_LOG(LogStomp, Log, TEXT("[Stomp] STOP: sensor DISABLED (was ACTIVE)  [monitorWas=%s]"),
-           // bMon ? TEXT("ON") : TEXT("OFF"));
-    }
-    else
-    {
-        //UE_LOG(LogStomp, Log, TEXT("[Stomp] STOP: (not active)  [monitorWas=%s]"),
-            //bMon ? TEXT("ON") : TEXT("OFF"));
-    }
+    bStompActive = false;
+    StompedThisFall.Reset();
+    //UE_LOG(LogStomp, Log, TEXT("[Stomp] STOP"));
 }
-
-
-
@@ -16,6 +16,14 @@ UCPP_GunComponent::UCPP_GunComponent()
 }
 
 
+void UCPP_GunComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// editor-set CurrentProfile: launch template must exist before the first ApplyFireMode
+	RebuildLaunchTemplate();
+}
+
 void UCPP_GunComponent::ApplyFireMode(const FFireModeProfile& Profile)
 {
 	CurrentProfile = Profile;
@@ -32,12 +40,35 @@ void UCPP_GunComponent::ApplyFireMode(const FFireModeProfile& Profile)
 	BurstShotsRemaining = 0;
 
 	SetRoundsPerMinute(CurrentProfile.RoundsPerMinute);
+	RebuildLaunchTemplate();
 
 	LastShotTime = -1.0;
 	LastBurstTriggerTime = -1.0;    // <<< ADD THIS
 	bWantsToFire = false;   // optional but nice to clean up
 }
 
+void UCPP_GunComponent::SetLaunchFlipbooks(const FProjectileAnimResolved& ProjectileConfig)
+{
+	BaseLaunch.SpawnFlipbook = ProjectileConfig.SpawnFlipbook;
+	BaseLaunch.LoopFlipbook = ProjectileConfig.LoopFlipbook;
+	BaseLaunch.ImpactFlipbook = ProjectileConfig.ImpactFlipbook;
+}
+
+void UCPP_GunComponent::RebuildLaunchTemplate()
+{
+	BaseLaunch.Speed = CurrentProfile.ProjectileSpeed;
+	BaseLaunch.Damage = CurrentProfile.DamagePerProjectile;
+	BaseLaunch.Scale = FMath::Max(0.01f, CurrentProfile.ProjectileScale);
+	BaseLaunch.bPenetrate = CurrentProfile.bPenetrate;
+
+	// 0 = derive from Range/Speed (same rule as the profile comment)
+	BaseLaunch.LifeSeconds = CurrentProfile.ProjectileLifeSeconds;
+	if (BaseLaunch.LifeSeconds <= 0.f && CurrentProfile.RangeUU > 0.f && CurrentProfile.ProjectileSpeed > 0.f)
+	{
+		BaseLaunch.LifeSeconds = CurrentProfile.RangeUU / CurrentProfile.ProjectileSpeed;
+	}
+}
+
 void UCPP_GunComponent::SetRoundsPerMinute(float NewRPM)
 {
 	RoundsPerMinute = FMath::Max(0.f, NewRPM);
@@ -244,6 +275,18 @@ void UCPP_GunComponent::FireVolley(int32 Count)
 	TArray<FVector> Dirs;
 	GenerateShotDirs(Count, Dirs);
 
+	if (bUseLaunchDescriptors)
+	{
+		// Template is already resolved; only the direction changes per shot
+		FProjectileLaunch Launch = BaseLaunch;
+		for (const FVector& Dir : Dirs)
+		{
+			Launch.Direction = Dir;
+			OnRequestLaunchShot(Launch, CurrentProjectileRowName);
+		}
+		return;
+	}
+
 	// Call your BP pool interface via one event (no C++ spawn)
 	for (const FVector& Dir : Dirs)
 	{
@@ -5,6 +5,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/Actor.h"
+#include "Subsystem/WS_Perception2D.h"
 
 UEnemyFSMComponent::UEnemyFSMComponent()
 {
@@ -31,17 +32,33 @@ void UEnemyFSMComponent::StartFSM()
 	}
 
 	// Ready → start sensing on a fixed interval
-	const float Interval = FMath::Max(0.05f, LOSInterval);
+	const float Interval = FMath::Max(0.05f, LOSInterval) * SenseScale;
 	GetWorld()->GetTimerManager().SetTimer(SenseTimer, this, &UEnemyFSMComponent::SenseAndDecide, Interval, true, Interval);
 }
 
+void UEnemyFSMComponent::SetSenseScale(float Scale)
+{
+	Scale = FMath::Max(1.f, Scale);
+	if (FMath::IsNearlyEqual(Scale, SenseScale)) return;
+	SenseScale = Scale;
+
+	// not sensing yet: StartFSM picks the scale up
+	FTimerManager& TM = GetWorld()->GetTimerManager();
+	if (!TM.IsTimerActive(SenseTimer)) return;
+
+	const float Interval = FMath::Max(0.05f, LOSInterval) * SenseScale;
+	const float FirstDelay = FMath::Min(TM.GetTimerRemaining(SenseTimer), Interval);
+	TM.SetTimer(SenseTimer, this, &UEnemyFSMComponent::SenseAndDecide, Interval, true, FirstDelay);
+}
+
 void UEnemyFSMComponent::SenseAndDecide()
 {
     if (!BB.IsValid()) return;
 
-    // 1) Look up the player (you can cache if you like)
+    // 1) Look up the player (cached per frame by the perception subsystem)
     APawn* Me = Pawn.Get();
-    APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    const UWS_Perception2D* Perception = UWS_Perception2D::Get(this);
+    APawn* Player = Perception ? Perception->GetPlayerPawn() : UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
     const float Now = GetWorld()->GetTimeSeconds();
 
     // 2) Decide acquire/lose and set/clear BB.AttackTarget
@@ -135,6 +152,15 @@ bool UEnemyFSMComponent::LOS2D(const APawn* Me, const AActor* T, float& OutDist)
 {
 	if (!Me || !T) { OutDist = 0.f; return false; }
 
+	// the player goes through the shared LOS batch (no result yet reads as no LOS)
+	UWS_Perception2D* Perception = UWS_Perception2D::Get(this);
+	if (Perception && T == Perception->GetPlayerPawn())
+	{
+		bool bLOS = false;
+		Perception->QueryPlayerLOS(Me, EyeHeight, SightRange, LOSChannel, bLOS, OutDist);
+		return bLOS;
+	}
+
 	const FVector M = Me->GetActorLocation();
 	const FVector P = T->GetActorLocation();
 	FVector D = P - M; D.Y = 0.f;               // XZ side-scroller; set D.Z=0 for XY
@@ -0,0 +1,258 @@
+﻿// Movement2DComponent.cpp
+
+
+#include "Components/Movement2DComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PhysicsVolume.h"
+#include "Engine/World.h"
+
+void UMovement2DComponent::StartSmashDown()
+{
+	if (SmashDownSpeed <= 0.f || !IsFalling()) return;
+	bSmashingDown = true;
+}
+
+void UMovement2DComponent::DropThrough()
+{
+	const UWorld* World = GetWorld();
+	if (!World || !IsMovingOnGround() || !IsOneWay(CurrentFloor.HitResult)) return;
+
+	DropThroughUntil = World->GetTimeSeconds() + DropThroughSeconds;
+	SetMovementMode(MOVE_Falling);
+}
+
+bool UMovement2DComponent::IsOneWay(const FHitResult& Hit) const
+{
+	if (OneWayTag.IsNone()) return false;
+
+	const UPrimitiveComponent* Comp = Hit.GetComponent();
+	if (Comp && Comp->ComponentHasTag(OneWayTag)) return true;
+
+	const AActor* Actor = Hit.GetActor();
+	return Actor && Actor->ActorHasTag(OneWayTag);
+}
+
+bool UMovement2DComponent::Sweep2D(const FVector& Delta, FHitResult& OutHit) const
+{
+	OutHit = FHitResult(1.f);
+
+	const UWorld* World = GetWorld();
+	const UCapsuleComponent* Capsule = CharacterOwner ? CharacterOwner->GetCapsuleComponent() : nullptr;
+	if (!World || !Capsule || Delta.IsNearlyZero()) return false;
+
+	float Radius = 0.f, HalfHeight = 0.f;
+	Capsule->GetScaledCapsuleSize(Radius, HalfHeight);
+	const FCollisionShape Box = FCollisionShape::MakeBox(FVector(Radius, Radius, HalfHeight));
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(Movement2D), false, CharacterOwner);
+	FCollisionResponseParams ResponseParams;
+	InitCollisionParams(Params, ResponseParams);
+
+	const FVector Start = UpdatedComponent->GetComponentLocation();
+	const bool bDropping = World->GetTimeSeconds() < DropThroughUntil;
+
+	// one-way platforms only block a downward move that starts with our feet above them;
+	// otherwise ignore that platform and sweep again (a handful of retries covers stacked strips)
+	for (int32 Attempt = 0; Attempt < 4; ++Attempt)
+	{
+		if (!World->SweepSingleByChannel(OutHit, Start, Start + Delta, FQuat::Identity,
+			UpdatedComponent->GetCollisionObjectType(), Box, Params, ResponseParams))
+		{
+			return false;
+		}
+
+		if (!IsOneWay(OutHit)) return true;
+
+		const bool bLandsOnTop = Delta.Z < 0.f && !bDropping && !OutHit.bStartPenetrating
+			&& OutHit.ImpactNormal.Z > 0.f && FMath::IsNearlyZero(Delta.X);
+		if (bLandsOnTop) return true;
+
+		Params.AddIgnoredComponent(OutHit.GetComponent());
+	}
+
+	OutHit = FHitResult(1.f);
+	return false;
+}
+
+bool UMovement2DComponent::MoveAxis2D(const FVector& Delta, FHitResult& OutHit)
+{
+	if (!Sweep2D(Delta, OutHit))
+	{
+		if (!Delta.IsNearlyZero())
+		{
+			UpdatedComponent->SetWorldLocation(UpdatedComponent->GetComponentLocation() + Delta);
+		}
+		return false;
+	}
+
+	const FVector Start = UpdatedComponent->GetComponentLocation();
+	if (OutHit.bStartPenetrating)
+	{
+		// already overlapping: push straight out instead of moving
+		UpdatedComponent->SetWorldLocation(Start + OutHit.Normal * (OutHit.PenetrationDepth + SkinWidth));
+		return true;
+	}
+
+	const float Dist = FMath::Max(OutHit.Distance - SkinWidth, 0.f);
+	if (Dist > 0.f)
+	{
+		UpdatedComponent->SetWorldLocation(Start + Delta.GetSafeNormal() * Dist);
+	}
+	return true;
+}
+
+void UMovement2DComponent::SetWallContact(bool bTouching, float NormalX)
+{
+	const float NewNormalX = bTouching ? FMath::Sign(NormalX) : 0.f;
+	if (bTouchingWall == bTouching && WallNormalX == NewNormalX) return;
+
+	bTouchingWall = bTouching;
+	WallNormalX = NewNormalX;
+	OnWallContactChanged.Broadcast(bTouchingWall, WallNormalX);
+}
+
+void UMovement2DComponent::MoveHorizontal2D(float DeltaX)
+{
+	if (FMath::IsNearlyZero(DeltaX))
+	{
+		SetWallContact(false, 0.f);
+		return;
+	}
+
+	FHitResult Hit;
+	if (MoveAxis2D(FVector(DeltaX, 0.f, 0.f), Hit))
+	{
+		Velocity.X = 0.f;
+		SetWallContact(FMath::Abs(Hit.ImpactNormal.X) > 0.7f, Hit.ImpactNormal.X);
+	}
+	else
+	{
+		SetWallContact(false, 0.f);
+	}
+}
+
+void UMovement2DComponent::NotifyFallStep(const FVector& From)
+{
+	bFallStepPending = false;
+
+	if (FallWatchSpeed >= 0.f && Velocity.Z < -FallWatchSpeed)
+	{
+		FallWatchSpeed = -1.f;
+		OnFallSpeedReached.Broadcast();
+	}
+
+	const FVector To = UpdatedComponent->GetComponentLocation();
+	if (To.Z < From.Z) OnFallStep.Broadcast(From, To);
+}
+
+void UMovement2DComponent::ProcessLanded(const FHitResult& Hit, float remainingTime, int32 Iterations)
+{
+	// before Landed -> StopStompWatch, so a stomp on the landing step still counts
+	if (bFallStepPending && UpdatedComponent) NotifyFallStep(FallStepFrom);
+
+	Super::ProcessLanded(Hit, remainingTime, Iterations);
+}
+
+void UMovement2DComponent::PhysWalking(float deltaTime, int32 Iterations)
+{
+	if (!bUseKinematic2D || HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
+	{
+		Super::PhysWalking(deltaTime, Iterations);
+		return;
+	}
+	if (deltaTime < MIN_TICK_TIME || !HasValidData()) return;
+
+	if (!CharacterOwner->Controller && !bRunPhysicsWithNoController)
+	{
+		Acceleration = FVector::ZeroVector;
+		Velocity = FVector::ZeroVector;
+		return;
+	}
+
+	const FVector OldLocation = UpdatedComponent->GetComponentLocation();
+
+	Velocity.Z = 0.f;
+	CalcVelocity(deltaTime, GroundFriction, false, GetMaxBrakingDeceleration());
+	Velocity.Y = 0.f;
+	Velocity.Z = 0.f;
+
+	MoveHorizontal2D(Velocity.X * deltaTime);
+
+	// stay glued to the floor; nothing under the feet = walked off a ledge
+	FHitResult FloorHit;
+	const bool bFloor = Sweep2D(FVector(0.f, 0.f, -(FloorProbeDistance + SkinWidth)), FloorHit)
+		&& !FloorHit.bStartPenetrating && IsWalkable2D(FloorHit);
+
+	if (!bFloor)
+	{
+		const FHitResult PrevFloor = CurrentFloor.HitResult;
+		CurrentFloor.Clear();
+		HandleWalkingOffLedge(PrevFloor.ImpactNormal, PrevFloor.Normal, OldLocation, deltaTime);
+		SetMovementMode(MOVE_Falling);
+		return;
+	}
+
+	const float Gap = FloorHit.Distance - SkinWidth;
+	if (Gap > UE_KINDA_SMALL_NUMBER)
+	{
+		UpdatedComponent->SetWorldLocation(UpdatedComponent->GetComponentLocation() - FVector(0.f, 0.f, Gap));
+	}
+
+	const bool bNewBase = FloorHit.GetComponent() != CurrentFloor.HitResult.GetComponent();
+	CurrentFloor.SetFromSweep(FloorHit, SkinWidth, true);
+	if (bNewBase) SetBaseFromFloor(CurrentFloor);
+}
+
+void UMovement2DComponent::PhysFalling(float deltaTime, int32 Iterations)
+{
+	if (!bUseKinematic2D || HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity())
+	{
+		// stock solver lands inside Super: ProcessLanded raises the hooks first if it gets there
+		FallStepFrom = UpdatedComponent->GetComponentLocation();
+		bFallStepPending = true;
+		Super::PhysFalling(deltaTime, Iterations);
+		if (bFallStepPending && UpdatedComponent) NotifyFallStep(FallStepFrom);
+		return;
+	}
+	if (deltaTime < MIN_TICK_TIME || !HasValidData()) return;
+
+	const FVector From = UpdatedComponent->GetComponentLocation();
+
+	// lateral: same air-control path as CharacterMovement, with Z kept out of the braking math
+	const float OldVz = Velocity.Z;
+	const FVector SavedAcceleration = Acceleration;
+	Acceleration = GetFallingLateralAcceleration(deltaTime);
+	Velocity.Z = 0.f;
+	CalcVelocity(deltaTime, FallingLateralFriction, false, GetMaxBrakingDeceleration());
+	Acceleration = SavedAcceleration;
+	Velocity.Y = 0.f;
+
+	if (bSmashingDown)
+	{
+		Velocity.X = 0.f;
+		Velocity.Z = -SmashDownSpeed;
+	}
+	else
+	{
+		Velocity.Z = FMath::Max(OldVz + GetGravityZ() * deltaTime, -GetPhysicsVolume()->TerminalVelocity);
+	}
+
+	MoveHorizontal2D(Velocity.X * deltaTime);
+
+	FHitResult Hit;
+	const bool bBlocked = MoveAxis2D(FVector(0.f, 0.f, Velocity.Z * deltaTime), Hit);
+	NotifyFallStep(From);
+	if (!bBlocked) return;
+
+	if (Velocity.Z <= 0.f && IsWalkable2D(Hit) && !Hit.bStartPenetrating)
+	{
+		bSmashingDown = false;
+		CurrentFloor.SetFromSweep(Hit, SkinWidth, true);
+		ProcessLanded(Hit, 0.f, Iterations);   // -> Character::Landed -> CustomEventOnLanded
+		return;
+	}
+
+	// ceiling or steep side
+	Velocity.Z = 0.f;
+}
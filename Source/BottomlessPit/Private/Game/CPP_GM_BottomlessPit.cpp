@@ -5,6 +5,11 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
+#include "Subsystem/WS_FireModeRegistry.h"
+#include "Subsystem/WS_FVXPool.h"
+#include "Actor/CPP_FVX.h"
+#include "Subsystem/WS_TrailBatch.h"
+#include "Subsystem/WS_ImpactBatch.h"
 
 ACPP_GM_BottomlessPit::ACPP_GM_BottomlessPit()
 {
@@ -25,6 +30,52 @@ ACPP_GM_BottomlessPit::ACPP_GM_BottomlessPit()
 void ACPP_GM_BottomlessPit::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (FireModeTable)
+    {
+        if (UWS_FireModeRegistry* Registry = UWS_FireModeRegistry::Get(this))
+        {
+            Registry->BuildFromTable(FireModeTable, ProjectilePrewarmPerMode);
+        }
+    }
+
+    if (FVXClass && VFXTable)
+    {
+        if (UWS_FVXPool* Pool = UWS_FVXPool::Get(this))
+        {
+            Pool->Prewarm(FVXClass, VFXTable, FVXPrewarmPerRow);
+        }
+    }
+
+    if (TrailQuadMesh)
+    {
+        if (UWS_TrailBatch* Batch = UWS_TrailBatch::Get(this))
+        {
+            Batch->Configure(TrailQuadMesh, TrailMaterial, TrailCapacity);
+        }
+    }
+
+    if (ImpactQuadMesh && ImpactSheetMaterial && VFXTable && InstancedImpactRows.Num() > 0)
+    {
+        if (UWS_ImpactBatch* Impacts = UWS_ImpactBatch::Get(this))
+        {
+            Impacts->Configure(ImpactQuadMesh, ImpactSheetMaterial);
+            Impacts->RegisterRowsFromTable(VFXTable, InstancedImpactRows, ImpactSheetColumns, ImpactCapacityPerRow);
+        }
+    }
+
+    if (UWS_EnemyLOD* Lod = UWS_EnemyLOD::Get(this))
+    {
+        // disabled = everything stays in Near (never rebucketed)
+        if (bUseEnemyTickLOD) Lod->Configure(EnemyLODSettings);
+        else                  Lod->SetEnabled(false);
+    }
+
+    if (UWS_EnemyActivation* Activation = UWS_EnemyActivation::Get(this))
+    {
+        Activation->Configure(EnemyActivationSettings);
+        Activation->SetEnabled(bBudgetEnemyActivation);
+    }
 }
 
 void ACPP_GM_BottomlessPit::StartScoring()
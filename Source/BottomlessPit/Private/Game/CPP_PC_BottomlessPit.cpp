@@ -2,7 +2,64 @@
 
 
 #include "Game/CPP_PC_BottomlessPit.h"
+#include "GameFramework/Pawn.h"
 
+ACPP_PC_BottomlessPit::ACPP_PC_BottomlessPit()
+{
+    PrimaryActorTick.TickGroup = TG_PrePhysics;
+}
 
+void ACPP_PC_BottomlessPit::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
 
+    // pawn reads the cursor sample in its Tick -> make sure ours ran first
+    if (InPawn) InPawn->AddTickPrerequisiteActor(this);
+}
 
+void ACPP_PC_BottomlessPit::OnUnPossess()
+{
+    if (APawn* OldPawn = GetPawn()) OldPawn->RemoveTickPrerequisiteActor(this);
+
+    Super::OnUnPossess();
+}
+
+void ACPP_PC_BottomlessPit::PreProcessInput(const float DeltaTime, const bool bGamePaused)
+{
+    Super::PreProcessInput(DeltaTime, bGamePaused);
+
+    // the viewport already holds this frame's mouse; sample before any input event fires
+    UpdateCursorSample();
+}
+
+void ACPP_PC_BottomlessPit::UpdateCursorSample()
+{
+    FCursorSample2D S;
+    S.Frame = GFrameCounter;
+
+    FVector WL, WD;
+    if (!GetMousePosition(S.MouseScreen.X, S.MouseScreen.Y) || !DeprojectScreenPositionToWorld(S.MouseScreen.X, S.MouseScreen.Y, WL, WD))
+    {
+        CursorSample = S;
+        return;
+    }
+
+    const APawn* P = GetPawn();
+    const FVector PawnLoc = P ? P->GetActorLocation() : FVector::ZeroVector;
+
+    // Intersect with plane Y = Pawn.Y (same select as the old per-actor BP math)
+    const double DeltaY = (double)PawnLoc.Y - (double)WL.Y;
+    const double DirY = (double)WD.Y;
+    const double t = FMath::IsNearlyZero(DirY) ? DeltaY : (DeltaY / DirY);
+
+    S.bValid = true;
+    S.WorldOnPlane = WL + WD * (float)t;
+
+    FVector Aim = S.WorldOnPlane - PawnLoc;
+    Aim.Y = 0.f;
+    S.AimDir = Aim.GetSafeNormal();
+
+    if (P) S.bPawnOnScreen = ProjectWorldLocationToScreen(PawnLoc, S.PawnScreen, true);
+
+    CursorSample = S;
+}
@@ -7,6 +7,7 @@
 #include "GameFramework/PlayerController.h"
 #include "InputCoreTypes.h"
 #include "Character/CPP_DownwellLiteCharacter.h"
+#include "Subsystem/WS_InputLatencyTracer.h"
 
 void ARR_DownwellPlayerController::BeginPlay()
 {
@@ -108,6 +109,7 @@ void ARR_DownwellPlayerController::OnLeftStarted(const FInputActionValue&)
     OnFirstInput();
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Move, this);
         SendCombinedAxis();
     }
 }
@@ -127,6 +129,7 @@ void ARR_DownwellPlayerController::OnLeftCompleted(const FInputActionValue&)
     OnFirstInput();
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Move, this);
         SendCombinedAxis();
     }
 }
@@ -137,6 +140,7 @@ void ARR_DownwellPlayerController::OnRightStarted(const FInputActionValue&)
     OnFirstInput();
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Move, this);
         SendCombinedAxis();
     }
 }
@@ -155,6 +159,7 @@ void ARR_DownwellPlayerController::OnRightCompleted(const FInputActionValue&)
     bRightHeld = false; 
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Move, this);
         SendCombinedAxis();
     }
 }
@@ -164,6 +169,7 @@ void ARR_DownwellPlayerController::OnDownStarted(const FInputActionValue&)
     OnFirstInput();
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Down, this);
         if (auto* C = GetDWChar())
             C->InputDownPressed();
     }
@@ -199,6 +205,7 @@ void ARR_DownwellPlayerController::OnJumpStarted(const FInputActionValue&)
         OnFirstInput();
         if (!IsPlayerDead && !ConfirmToExit)
         {
+            if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Jump, this);
             if (auto* C = GetDWChar())
                 C->InputJumpPressed();
         }
@@ -227,6 +234,7 @@ void ARR_DownwellPlayerController::OnMoveX_Started(const FInputActionValue& Valu
     OnFirstInput();
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Move, this);
         float Axis = FMath::Clamp(Value.Get<float>(), -1.f, 1.f);
         // Safety deadzone (optional; IMC deadzone should already handle it)
         if (FMath::Abs(Axis) < 0.2f) Axis = 0.f;
@@ -253,6 +261,7 @@ void ARR_DownwellPlayerController::OnMoveX_Completed(const FInputActionValue& Va
 {
     if (!IsPlayerDead && !ConfirmToExit)
     {
+        if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(this)) Tracer->Stamp(EInputLatencyKind::Move, this);
         if (auto* C = GetDWChar())
             C->SetMoveAxis(0.f);
     }
@@ -5,6 +5,7 @@
 #include "Components/CapsuleComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Subsystem/WS_EnemySim.h"
 
 ACPP_BlpEnemies::ACPP_BlpEnemies()
 {
@@ -66,10 +67,42 @@ void ACPP_BlpEnemies::ActivateFromPool(const FVector& WorldPos)
     BaseZ = GetActorLocation().Z;
     FlipCooldown = 0.f;
     bAIOn = true;
+
+    if (bUseCentralSim)
+    {
+        if (UWS_EnemySim* Sim = UWS_EnemySim::Get(this))
+        {
+            Sim->Add(this);
+            SetActorTickEnabled(false);
+            if (UFloatingPawnMovement* Mv = FindComponentByClass<UFloatingPawnMovement>())
+            {
+                Mv->SetComponentTickEnabled(false);
+            }
+        }
+    }
+}
+
+void ACPP_BlpEnemies::BindToStrip(APlatformStrip* Strip)
+{
+    if (Kind != EBPEnemyKind::Walker || !Strip || SimSlot == INDEX_NONE) return;
+
+    if (UWS_EnemySim* Sim = UWS_EnemySim::Get(this))
+    {
+        Sim->BindStrip(this, Strip);
+    }
 }
 
 void ACPP_BlpEnemies::DeactivateToPool()
 {
+    if (SimSlot != INDEX_NONE)
+    {
+        if (UWS_EnemySim* Sim = UWS_EnemySim::Get(this)) Sim->Remove(this);
+        if (UFloatingPawnMovement* Mv = FindComponentByClass<UFloatingPawnMovement>())
+        {
+            Mv->SetComponentTickEnabled(true);
+        }
+    }
+
     Super::DeactivateToPool();
 
     bAIOn = false;
@@ -83,7 +116,7 @@ void ACPP_BlpEnemies::DeactivateToPool()
 void ACPP_BlpEnemies::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
-    if (!IsActive() || !bAIOn) return;
+    if (!IsActive() || !bAIOn || SimSlot != INDEX_NONE) return;
 
     FlipCooldown = FMath::Max(0.f, FlipCooldown - DeltaSeconds);
 
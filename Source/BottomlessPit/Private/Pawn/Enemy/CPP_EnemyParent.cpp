@@ -9,8 +9,15 @@
 #include "PaperFlipbookComponent.h"
 #include "GameFramework/FloatingPawnMovement.h"
 #include "Kismet/GameplayStatics.h"
-#include "Utility/Util_BpAsyncEnemyAnim.h"
+#include "Subsystem/WS_EnemyAnimRowCache.h"
 #include "AIController.h"
+#include "Subsystem/WS_SpatialHash2D.h"
+#include "Subsystem/WS_EnemyLOD.h"
+#include "Subsystem/WS_EnemyActivation.h"
+#include "Subsystem/WS_EnemyFSM.h"
+#include "Subsystem/WS_EnemyFlipbookAnim.h"
+#include "AI/FSM/DA_EnemyArchetypeFSM.h"
+#include "Components/EnemyFSMComponent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogEnemy, Log, All);
 
@@ -60,11 +67,30 @@ void ACPP_EnemyParent::SetOverlapEnabled(bool bEnabled)
 	}
 }
 
+FCollisionResponseContainer ACPP_EnemyParent::MakeActiveResponses() const
+{
+	FCollisionResponseContainer R(ECR_Ignore);
+	R.SetResponse(PlayerChannel, ECR_Overlap);
+	R.SetResponse(ProjectileChannel, ECR_Block);
+	R.SetResponse(BulletChannel, ECR_Block);
+	return R;
+}
+
 void ACPP_EnemyParent::ConfigureCollision_Active()
 {
 	if (!Capsule) Capsule = FindComponentByClass<UCapsuleComponent>();
 	if (!Capsule) return;
 
+	if (bKeepBodyWhenPooled)
+	{
+		// body stays QueryOnly for life; only filter data changes (one update for all channels)
+		if (Capsule->GetCollisionEnabled() != ECollisionEnabled::QueryOnly) Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		if (Capsule->GetCollisionObjectType() != ECC_Pawn) Capsule->SetCollisionObjectType(ECC_Pawn);
+		Capsule->SetCollisionResponseToChannels(MakeActiveResponses());
+		Capsule->SetGenerateOverlapEvents(true);
+		return;
+	}
+
 	Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	Capsule->SetGenerateOverlapEvents(true);
 	Capsule->SetCollisionObjectType(ECC_Pawn);
@@ -84,6 +110,12 @@ void ACPP_EnemyParent::ConfigureCollision_Dying()
 
 	// During the death anim: be invisible to gameplay
 	Capsule->SetGenerateOverlapEvents(false);
+	if (bKeepBodyWhenPooled)
+	{
+		Capsule->SetCollisionResponseToChannels(FCollisionResponseContainer(ECR_Ignore));
+		return;
+	}
+
 	Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	Capsule->SetCollisionResponseToAllChannels(ECR_Ignore);
 	// (Explicitly ignore both to be crystal clear)
@@ -98,42 +130,21 @@ void ACPP_EnemyParent::ConfigureCollision_Pooled()
 	if (!Capsule) return;
 
 	Capsule->SetGenerateOverlapEvents(false);
-	Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	Capsule->SetCollisionResponseToAllChannels(ECR_Ignore);
-}
-
-void ACPP_EnemyParent::ActivateNow_Internal(const FVector& WorldPos)
-{
-	// visible & ticking
-	SetActorLocation(WorldPos);
-	SetActorHiddenInGame(false);
-	SetActorTickEnabled(true);
-
-	// collision for gameplay
-	ConfigureCollision_Active();
-
-	// reset health if present
-	if (HealthComp)
+	if (bKeepBodyWhenPooled)
 	{
-		HealthComp->isDead = false;
-		HealthComp->SetCurrentHealth(HealthComp->GetMaxHealth());
+		// filtered out, not torn down: no query channel reaches an all-ignore body
+		Capsule->SetCollisionResponseToChannels(FCollisionResponseContainer(ECR_Ignore));
+		return;
 	}
-	if (Sprite) Sprite->SetVisibility(true, true);
-
-	LifeState = EEnemyLifeState::Active;
-	bActive = true;
-
-	/*UE_LOG(LogEnemy, Log, TEXT("[ENEMY] ACTIVATE  %s  this=%p  Pos=(%.0f,%.0f,%.0f)"),
-		*GetName(), this, WorldPos.X, WorldPos.Y, WorldPos.Z);*/
 
-	// (Optional) BP hook
-	OnPooledActivated();
+	Capsule->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Capsule->SetCollisionResponseToAllChannels(ECR_Ignore);
 }
 
-void ACPP_EnemyParent::DeferredActivateFromPool()
+void ACPP_EnemyParent::HandleAnimRowResolved(const FEnemyAnimResolved* Resolved)
 {
-	bPendingActivate = false;
-	ActivateNow_Internal(PendingActivatePos);
+	if (Resolved) HandleAnimsLoaded_Internal(AnimationRowName, *Resolved);
+	else HandleAnimLoadFailed_Internal();
 }
 
 void ACPP_EnemyParent::HandleAnimsLoaded_Internal(FName RowName, const FEnemyAnimResolved& Anim)
@@ -147,6 +158,12 @@ void ACPP_EnemyParent::HandleAnimsLoaded_Internal(FName RowName, const FEnemyAni
 
 	// 3. Broadcast the BLUEPRINT delegate!
 	OnAnimsReady.Broadcast(ResolvedAnims);
+
+	// activated before the row resolved: start the flipbook driver now
+	if (bUseFlipbookFastPath && IsActive())
+	{
+		if (UWS_EnemyFlipbookAnim* FlipbookAnim = UWS_EnemyFlipbookAnim::Get(this)) FlipbookAnim->Add(this);
+	}
 }
 
 void ACPP_EnemyParent::HandleAnimLoadFailed_Internal()
@@ -165,6 +182,32 @@ void ACPP_EnemyParent::SetAIMoveState(EAIMovementState NewState)
 	OnAIMoveStateChanged.Broadcast(Old, NewState);
 }
 
+void ACPP_EnemyParent::ApplyTickLOD(EEnemyTickLOD InLOD, float TickInterval, float SenseScale)
+{
+	TickLOD = InLOD;
+	AISenseScale = SenseScale;
+
+	SetActorTickInterval(TickInterval);
+	if (MoveComp) MoveComp->SetComponentTickInterval(TickInterval);
+	if (Sprite) Sprite->SetComponentTickInterval(TickInterval);
+	if (BodyAnim) BodyAnim->SetComponentTickInterval(TickInterval);
+
+	// the FSM lives on the controller
+	if (const AController* C = GetController())
+	{
+		if (UEnemyFSMComponent* FSM = C->FindComponentByClass<UEnemyFSMComponent>()) FSM->SetSenseScale(SenseScale);
+	}
+}
+
+int32 ACPP_EnemyParent::CountLODTickingComponents() const
+{
+	int32 N = IsActorTickEnabled() ? 1 : 0;
+	if (MoveComp && MoveComp->IsComponentTickEnabled()) ++N;
+	if (Sprite && Sprite->IsComponentTickEnabled()) ++N;
+	if (BodyAnim && BodyAnim->IsComponentTickEnabled()) ++N;
+	return N;
+}
+
 void ACPP_EnemyParent::BeginDeath()
 {
 	// Already dying or pooled? nothing to do.
@@ -178,6 +221,10 @@ void ACPP_EnemyParent::BeginDeath()
 	if (HealthComp) HealthComp->isDead = true;
 	ConfigureCollision_Dying();
 
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Unregister(this);
+	if (UWS_EnemyLOD* Lod = UWS_EnemyLOD::Get(this)) Lod->Unregister(this);
+	if (UWS_EnemyFSM* FSM = UWS_EnemyFSM::Get(this)) FSM->Remove(this);
+
 	/*UE_LOG(LogEnemy, Warning, TEXT("[ENEMY] BEGIN_DEATH %s this=%p t=%.3f (LifeState=Dying)"),
 		*GetName(), this, GetWorld()->TimeSeconds);*/
 }
@@ -205,6 +252,12 @@ void ACPP_EnemyParent::ActivateFromPool(const FVector& WorldPos)
 	SetActorLocation(WorldPos);
 	SetActorHiddenInGame(false);
 	SetActorTickEnabled(true);
+	if (bKeepBodyWhenPooled)
+	{
+		// fast path: frames come from UWS_EnemyFlipbookAnim, the sprite never ticks
+		if (Sprite) Sprite->SetComponentTickEnabled(!bUseFlipbookFastPath);
+		if (BodyAnim) BodyAnim->SetComponentTickEnabled(true);
+	}
 
 	ConfigureCollision_Active();
 
@@ -215,21 +268,116 @@ void ACPP_EnemyParent::ActivateFromPool(const FVector& WorldPos)
 	}
 	if (Sprite) Sprite->SetVisibility(true, true);
 
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Register(this, ESpatialKind2D::Enemy);
+	if (UWS_EnemyLOD* Lod = UWS_EnemyLOD::Get(this)) Lod->Register(this);
+	if (ArchetypeFSM)
+	{
+		if (UWS_EnemyFSM* FSM = UWS_EnemyFSM::Get(this)) FSM->Add(this);
+	}
+	if (bUseFlipbookFastPath)
+	{
+		if (UWS_EnemyFlipbookAnim* FlipbookAnim = UWS_EnemyFlipbookAnim::Get(this)) FlipbookAnim->Add(this);
+	}
+
 	/*UE_LOG(LogEnemy, Log, TEXT("[ENEMY] ACTIVATE %s this=%p Pos=(%.0f,%.0f,%.0f) (LifeState=Active)"),
 		*GetName(), this, WorldPos.X, WorldPos.Y, WorldPos.Z);*/
 }
 
+void ACPP_EnemyParent::RequestActivateFromPool(const FVector& WorldPos, APlatformStrip* Strip)
+{
+	if (LifeState == EEnemyLifeState::Dying) return;   // same rule as ActivateFromPool
+
+	PendingActivatePos = WorldPos;
+	PendingStrip = Strip;
+	bPendingHasStrip = (Strip != nullptr);
+	bPendingActivate = true;
+
+	const uint32 Ticket = ++ActivationTicket;
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double ReadyTime = FMath::Max(Now, double(PooledAtTime + MinReuseDelay));
+
+	UWS_EnemyActivation* Queue = UWS_EnemyActivation::Get(this);
+	if (Queue && Queue->IsEnabled())
+	{
+		Queue->Enqueue(this, Ticket, ReadyTime);
+		return;
+	}
+
+	// no queue means no budget, not no reuse delay
+	if (ReadyTime <= Now)
+	{
+		ApplyQueuedActivation(Ticket);
+		return;
+	}
+
+	GetWorldTimerManager().SetTimer(ReuseDelayTimer,
+		FTimerDelegate::CreateWeakLambda(this, [this, Ticket]() { ApplyQueuedActivation(Ticket); }),
+		float(ReadyTime - Now), false);
+}
+
+void ACPP_EnemyParent::BenchmarkCollisionToggle()
+{
+	ConfigureCollision_Active();
+	ConfigureCollision_Pooled();
+}
+
+bool ACPP_EnemyParent::IsReuseDelayElapsed() const
+{
+	const UWorld* W = GetWorld();
+	return !W || W->GetTimeSeconds() - PooledAtTime >= MinReuseDelay;
+}
+
+bool ACPP_EnemyParent::ApplyQueuedActivation(uint32 Ticket)
+{
+	if (!bPendingActivate || Ticket != ActivationTicket) return false;
+	bPendingActivate = false;
+
+	// the row this walker was meant for was culled while it waited
+	APlatformStrip* Strip = PendingStrip.Get();
+	PendingStrip.Reset();
+	if (bPendingHasStrip && !Strip) return false;
+
+	ActivateFromPool(PendingActivatePos);
+	if (!IsActive()) return false;
+
+	BindToStrip(Strip);
+	return true;
+}
+
 void ACPP_EnemyParent::DeactivateToPool()
 {
 	// Transition: Dying/Active -> Pooled
+	const bool bWasInUse = LifeState != EEnemyLifeState::Pooled;
 	LifeState = EEnemyLifeState::Pooled;
 	bActive = false;
 
+	// drops a queued activation; reuse waits MinReuseDelay from the last time it was in use
+	// (fresh pool spawns and repeat deactivations don't restart the delay)
+	bPendingActivate = false;
+	++ActivationTicket;
+	GetWorldTimerManager().ClearTimer(ReuseDelayTimer);
+	if (const UWorld* W = GetWorld(); W && bWasInUse) PooledAtTime = W->GetTimeSeconds();
+
 	ConfigureCollision_Pooled();
 
+	if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->Unregister(this);
+	if (UWS_EnemyLOD* Lod = UWS_EnemyLOD::Get(this)) Lod->Unregister(this);
+	if (UWS_EnemyFSM* FSM = UWS_EnemyFSM::Get(this)) FSM->Remove(this);
+	if (UWS_EnemyFlipbookAnim* FlipbookAnim = UWS_EnemyFlipbookAnim::Get(this)) FlipbookAnim->Remove(this);
+
 	SetActorTickEnabled(false);
 	SetActorHiddenInGame(true);
-	SetActorLocation(FVector(0.f, -100000.f, -100000.f)); // park
+
+	if (bKeepBodyWhenPooled)
+	{
+		// dormant in place: hidden, filtered, no component ticks; no teleport through the broadphase
+		if (Sprite) Sprite->SetComponentTickEnabled(false);
+		if (BodyAnim) BodyAnim->SetComponentTickEnabled(false);
+	}
+	else
+	{
+		SetActorLocation(FVector(0.f, -100000.f, -100000.f)); // park
+	}
 
 	/*UE_LOG(LogEnemy, Log, TEXT("[ENEMY] DEACTIVATE %s this=%p t=%.3f (LifeState=Pooled)"),
 		*GetName(), this, GetWorld()->TimeSeconds);*/
@@ -247,29 +395,12 @@ void ACPP_EnemyParent::BeginPlay()
 		MoveComp->Deceleration = FMath::Max(1000.f, Friction * 100.f);
 	}
 
-	if (AnimationDataTable && !AnimationRowName.IsNone())
+	UWS_EnemyAnimRowCache* AnimCache = UWS_EnemyAnimRowCache::Get(this);
+	if (AnimCache && AnimationDataTable && !AnimationRowName.IsNone())
 	{
-		// 1. Create the Async Action
-		AnimLoadAction = UUtil_BpAsyncEnemyAnim::LoadEnemyAnimRowAsync(
-			this,
-			AnimationDataTable,
-			AnimationRowName,
-			-1 // VariantIndex
-		);
-
-		if (AnimLoadAction)
-		{
-			// 2. Bind our C++ functions to the action's delegates
-			//
-			//    *** THIS IS THE FIX ***
-			//    Use your class name 'ACPP_EnemyParent' not 'AMyBaseEnemy'
-			//
-			AnimLoadAction->OnCompleted.AddDynamic(this, &ACPP_EnemyParent::HandleAnimsLoaded_Internal);
-			AnimLoadAction->OnFailed.AddDynamic(this, &ACPP_EnemyParent::HandleAnimLoadFailed_Internal);
-
-			// 3. Start the action
-			AnimLoadAction->Activate();
-		}
+		// One load per (table, row) for the whole pool; fires right away when the generator already warmed it
+		AnimCache->Request(AnimationDataTable, AnimationRowName,
+			FOnEnemyAnimRowResolved::CreateUObject(this, &ACPP_EnemyParent::HandleAnimRowResolved));
 	}
 	else
 	{
@@ -279,10 +410,41 @@ void ACPP_EnemyParent::BeginPlay()
 	}
 }
 
+void ACPP_EnemyParent::SpawnDefaultController()
+{
+	// archetype brains tick in UWS_EnemyFSM; the controller only has to feed FloatingPawnMovement
+	if (ArchetypeFSM) AIControllerClass = AAIController::StaticClass();
+	Super::SpawnDefaultController();
+}
+
+void ACPP_EnemyParent::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	if (!bUseFlipbookFastPath) return;
+
+	// no PaperZD component / anim instance per enemy; the batched driver owns the sprite's playback
+	if (BodyAnim)
+	{
+		BodyAnim->DestroyComponent();
+		BodyAnim = nullptr;
+	}
+	if (Sprite)
+	{
+		Sprite->Stop();
+		Sprite->SetComponentTickEnabled(false);
+	}
+}
+
 // Called every frame
 void ACPP_EnemyParent::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	if (LifeState == EEnemyLifeState::Active)
+	{
+		if (UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this)) Hash->UpdateActor(this);
+	}
 }
 
 // Called to bind functionality to input
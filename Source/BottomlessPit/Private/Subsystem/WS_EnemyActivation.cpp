@@ -0,0 +1,170 @@
+﻿// WS_EnemyActivation.cpp
+
+
+#include "Subsystem/WS_EnemyActivation.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+
+static FAutoConsoleCommandWithWorldAndArgs GBenchEnemyPoolCmd(
+	TEXT("bp.BenchEnemyPool"),
+	TEXT("Time enemy pool collision toggles with the legacy and keep-body pooled states. Args: [Cycles=200]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UWS_EnemyActivation* Activation = UWS_EnemyActivation::Get(World))
+			{
+				Activation->BenchmarkPoolCycle(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200);
+			}
+		}));
+
+UWS_EnemyActivation* UWS_EnemyActivation::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_EnemyActivation>() : nullptr;
+}
+
+bool UWS_EnemyActivation::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_EnemyActivation::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_EnemyActivation, STATGROUP_Tickables);
+}
+
+void UWS_EnemyActivation::Deinitialize()
+{
+	Queue.Empty();
+	Stats = FEnemyActivationStats();
+	Super::Deinitialize();
+}
+
+void UWS_EnemyActivation::Enqueue(ACPP_EnemyParent* Enemy, uint32 Ticket, double ReadyTime)
+{
+	if (!IsValid(Enemy)) return;
+
+	FPending P;
+	P.Enemy = Enemy;
+	P.ReadyTime = ReadyTime;
+	P.RequestTime = GetWorld()->GetTimeSeconds();
+	P.Seq = NextSeq++;
+	P.Ticket = Ticket;
+	Queue.HeapPush(P);
+
+	Stats.QueueDepth = Queue.Num();
+	Stats.PeakQueueDepth = FMath::Max(Stats.PeakQueueDepth, Stats.QueueDepth);
+}
+
+void UWS_EnemyActivation::Tick(float DeltaTime)
+{
+	Stats.AppliedLastFrame = 0;
+	Stats.LastFrameCostMs = 0.f;
+	if (Queue.Num() == 0) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double Start = FPlatformTime::Seconds();
+	const double BudgetSec = Settings.BudgetMs * 0.001;
+
+	while (Queue.Num() > 0 && Queue.HeapTop().ReadyTime <= Now)
+	{
+		if (Stats.AppliedLastFrame >= Settings.MaxPerFrame) break;
+		if (Stats.AppliedLastFrame > 0 && FPlatformTime::Seconds() - Start >= BudgetSec) break;
+
+		FPending P;
+		Queue.HeapPop(P, EAllowShrinking::No);
+
+		// dropped if the enemy was destroyed or deactivated / re-requested since
+		ACPP_EnemyParent* E = P.Enemy.Get();
+		if (!IsValid(E) || !E->ApplyQueuedActivation(P.Ticket)) continue;
+
+		++Stats.AppliedLastFrame;
+		++Stats.TotalApplied;
+
+		const float WaitMs = float(Now - P.RequestTime) * 1000.f;
+		Stats.AvgWaitMs = FMath::Lerp(Stats.AvgWaitMs, WaitMs, 0.1f);
+	}
+
+	Stats.LastFrameCostMs = float(FPlatformTime::Seconds() - Start) * 1000.f;
+	Stats.QueueDepth = Queue.Num();
+}
+
+void UWS_EnemyActivation::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[EnemyActivation] depth=%d peak=%d applied(last frame)=%d total=%d avgWait=%.1f ms lastCost=%.3f ms"),
+		Stats.QueueDepth, Stats.PeakQueueDepth, Stats.AppliedLastFrame, Stats.TotalApplied, Stats.AvgWaitMs, Stats.LastFrameCostMs);
+}
+
+FEnemyPoolBenchResult UWS_EnemyActivation::BenchmarkPoolCycle(int32 Cycles)
+{
+	FEnemyPoolBenchResult Result;
+	Result.Cycles = FMath::Clamp(Cycles, 1, 100000);
+
+	// any idle pooled enemy; the cycle ends pooled again, so gameplay never sees it
+	ACPP_EnemyParent* E = nullptr;
+	for (TActorIterator<ACPP_EnemyParent> It(GetWorld()); It; ++It)
+	{
+		if (It->GetLifeState() == EEnemyLifeState::Pooled && !It->IsPendingActivate()) { E = *It; break; }
+	}
+	if (!E)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[EnemyActivation] Benchmark: no pooled enemy in the world"));
+		return Result;
+	}
+
+	const bool bWasKeepBody = E->bKeepBodyWhenPooled;
+	const FVector At = E->GetActorLocation();
+	const FVector Park(0.f, -100000.f, -100000.f);   // same spot DeactivateToPool parks at
+
+	// only the physics side of ActivateFromPool / DeactivateToPool; the enemy stays Pooled throughout
+	auto Run = [&](bool bKeepBody) -> float
+		{
+			E->bKeepBodyWhenPooled = bKeepBody;
+			E->DeactivateToPool();   // settle into this mode's pooled state first
+
+			const double Start = FPlatformTime::Seconds();
+			for (int32 i = 0; i < Result.Cycles; ++i)
+			{
+				E->SetActorLocation(At);
+				E->BenchmarkCollisionToggle();
+				if (!bKeepBody) E->SetActorLocation(Park);
+			}
+			return float((FPlatformTime::Seconds() - Start) * 1e6 / Result.Cycles);
+		};
+
+	Result.LegacyUsPerCycle = Run(false);
+	Result.KeepBodyUsPerCycle = Run(true);
+
+	E->bKeepBodyWhenPooled = bWasKeepBody;
+	E->DeactivateToPool();
+	E->SetActorLocation(At);
+
+	UE_LOG(LogTemp, Log, TEXT("[EnemyActivation] pool collision toggle x%d on %s: legacy=%.2f us  keepBody=%.2f us  (%.1fx)"),
+		Result.Cycles, *E->GetName(), Result.LegacyUsPerCycle, Result.KeepBodyUsPerCycle,
+		Result.KeepBodyUsPerCycle > 0.f ? Result.LegacyUsPerCycle / Result.KeepBodyUsPerCycle : 0.f);
+
+	LastPoolBench = Result;
+	AppendPoolBenchCSV(Result, E->GetName());
+	return Result;
+}
+
+void UWS_EnemyActivation::AppendPoolBenchCSV(const FEnemyPoolBenchResult& Result, const FString& EnemyName) const
+{
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("Profiling") / TEXT("EnemyPoolBench.csv");
+
+	FString Csv;
+	if (!FPaths::FileExists(Path)) Csv = TEXT("Time,Enemy,Cycles,LegacyUs,KeepBodyUs\n");
+	Csv += FString::Printf(TEXT("%s,%s,%d,%.3f,%.3f\n"), *FDateTime::Now().ToString(), *EnemyName,
+		Result.Cycles, Result.LegacyUsPerCycle, Result.KeepBodyUsPerCycle);
+
+	if (!FFileHelper::SaveStringToFile(Csv, *Path, FFileHelper::EEncodingOptions::AutoDetect,
+		&IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[EnemyActivation] could not write %s"), *Path);
+	}
+}
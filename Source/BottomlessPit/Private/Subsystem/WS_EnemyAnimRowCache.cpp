@@ -0,0 +1,185 @@
+﻿// WS_EnemyAnimRowCache.cpp
+
+
+#include "Subsystem/WS_EnemyAnimRowCache.h"
+#include "Engine/World.h"
+#include "Engine/DataTable.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "AnimSequences/PaperZDAnimSequence.h"
+
+UWS_EnemyAnimRowCache* UWS_EnemyAnimRowCache::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_EnemyAnimRowCache>() : nullptr;
+}
+
+bool UWS_EnemyAnimRowCache::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWS_EnemyAnimRowCache::Deinitialize()
+{
+	for (TPair<FRowKey, FEntry>& It : Entries)
+	{
+		if (It.Value.Handle.IsValid()) It.Value.Handle->CancelHandle();
+	}
+	Entries.Empty();
+	HeldAssets.Empty();
+	Super::Deinitialize();
+}
+
+const FEnemyAnimResolved* UWS_EnemyAnimRowCache::Find(const UDataTable* Table, FName RowName) const
+{
+	const FEntry* E = Entries.Find(FRowKey(Table, RowName));
+	return (E && E->bReady) ? &E->Resolved : nullptr;
+}
+
+void UWS_EnemyAnimRowCache::Request(UDataTable* Table, FName RowName, FOnEnemyAnimRowResolved OnDone)
+{
+	if (!IsValid(Table) || RowName.IsNone())
+	{
+		OnDone.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	FEntry* E = Entries.Find(FRowKey(Table, RowName));
+	if (!E) E = StartLoad(Table, RowName);
+	if (!E)
+	{
+		OnDone.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	if (E->bReady)
+	{
+		OnDone.ExecuteIfBound(&E->Resolved);
+		return;
+	}
+
+	// already streaming: join it
+	E->Waiters.Add(MoveTemp(OnDone));
+}
+
+void UWS_EnemyAnimRowCache::Preload(UDataTable* Table, FName RowName)
+{
+	if (!IsValid(Table) || RowName.IsNone()) return;
+	if (!Entries.Contains(FRowKey(Table, RowName))) StartLoad(Table, RowName);
+}
+
+void UWS_EnemyAnimRowCache::FlushPending(float TimeoutSeconds)
+{
+	TArray<TPair<FRowKey, TSharedPtr<FStreamableHandle>>> Pending;
+	for (TPair<FRowKey, FEntry>& It : Entries)
+	{
+		if (!It.Value.bReady && It.Value.Handle.IsValid()) Pending.Emplace(It.Key, It.Value.Handle);
+	}
+
+	for (TPair<FRowKey, TSharedPtr<FStreamableHandle>>& P : Pending)
+	{
+		if (P.Value->WaitUntilComplete(TimeoutSeconds) != EAsyncPackageState::Complete)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[EnemyAnimRowCache] %s still loading after flush"), *P.Key.Value.ToString());
+			continue;
+		}
+
+		// the streamable delegate may be deferred to a later tick; resolve now from the loaded row
+		const FEntry* E = Entries.Find(P.Key);
+		const UDataTable* Table = P.Key.Key.ResolveObjectPtr();
+		if (!E || E->bReady || !Table) continue;
+
+		if (const FEnemyAnimRow* Row = Table->FindRow<FEnemyAnimRow>(P.Key.Value, TEXT("EnemyAnimRowCache")))
+		{
+			OnRowLoaded(P.Key, *Row);
+		}
+	}
+}
+
+UWS_EnemyAnimRowCache::FEntry* UWS_EnemyAnimRowCache::StartLoad(UDataTable* Table, FName RowName)
+{
+	const FEnemyAnimRow* Row = Table->FindRow<FEnemyAnimRow>(RowName, TEXT("EnemyAnimRowCache"));
+	if (!Row) return nullptr;
+
+	const FRowKey Key(Table, RowName);
+	Entries.Add(Key);
+
+	TArray<FSoftObjectPath> Paths;
+	for (const TSoftObjectPtr<UPaperZDAnimSequence>* Soft : { &Row->Idle, &Row->Jump_Land, &Row->Jump_Start,
+		&Row->Jump_Falling, &Row->Slide, &Row->Dash, &Row->Walk, &Row->Roll, &Row->Death, &Row->LedgeClimb,
+		&Row->AirSpin, &Row->Run })
+	{
+		if (!Soft->IsNull()) Paths.Add(Soft->ToSoftObjectPath());
+	}
+	for (const TSoftObjectPtr<UPaperZDAnimSequence>& Var : Row->Variants)
+	{
+		if (!Var.IsNull()) Paths.Add(Var.ToSoftObjectPath());
+	}
+
+	if (Paths.Num() == 0)
+	{
+		OnRowLoaded(Key, *Row);
+		return Entries.Find(Key);
+	}
+
+	// Held after completion so the sequences never unload under a pooled enemy
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths,
+		FStreamableDelegate::CreateUObject(this, &UWS_EnemyAnimRowCache::OnRowLoaded, Key, *Row));
+
+	if (!Handle.IsValid())
+	{
+		Entries.Remove(Key);
+		return nullptr;
+	}
+
+	// the delegate can fire inside RequestAsyncLoad when everything is already resident
+	FEntry* Live = Entries.Find(Key);
+	if (Live) Live->Handle = Handle;
+	return Live;
+}
+
+void UWS_EnemyAnimRowCache::OnRowLoaded(FRowKey Key, FEnemyAnimRow Row)
+{
+	FEntry* E = Entries.Find(Key);
+	if (!E || E->bReady) return;   // FlushPending may have resolved it first
+
+	FEnemyAnimResolved& R = E->Resolved;
+	R.Idle = Row.Idle.Get();
+	R.Jump_Land = Row.Jump_Land.Get();
+	R.Jump_Start = Row.Jump_Start.Get();
+	R.Jump_Falling = Row.Jump_Falling.Get();
+	R.Slide = Row.Slide.Get();
+	R.Dash = Row.Dash.Get();
+	R.Walk = Row.Walk.Get();
+	R.Roll = Row.Roll.Get();
+	R.Death = Row.Death.Get();
+	R.LedgeClimb = Row.LedgeClimb.Get();
+	R.AirSpin = Row.AirSpin.Get();
+	R.Run = Row.Run.Get();
+
+	R.Variants.Reset(Row.Variants.Num());
+	for (const TSoftObjectPtr<UPaperZDAnimSequence>& Var : Row.Variants)
+	{
+		R.Variants.Add(Var.Get());
+	}
+
+	for (UPaperZDAnimSequence* Seq : { R.Idle, R.Jump_Land, R.Jump_Start, R.Jump_Falling, R.Slide, R.Dash,
+		R.Walk, R.Roll, R.Death, R.LedgeClimb, R.AirSpin, R.Run })
+	{
+		if (Seq) HeldAssets.AddUnique(Seq);
+	}
+	for (UPaperZDAnimSequence* Seq : R.Variants)
+	{
+		if (Seq) HeldAssets.AddUnique(Seq);
+	}
+	E->bReady = true;
+
+	// Waiters may request again from inside the callback; iterate a detached list
+	TArray<FOnEnemyAnimRowResolved> Waiters = MoveTemp(E->Waiters);
+	const FEnemyAnimResolved Resolved = E->Resolved;
+	for (FOnEnemyAnimRowResolved& W : Waiters)
+	{
+		W.ExecuteIfBound(&Resolved);
+	}
+}
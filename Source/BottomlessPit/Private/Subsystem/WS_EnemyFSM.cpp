@@ -0,0 +1,620 @@
+﻿// WS_EnemyFSM.cpp
+
+
+#include "Subsystem/WS_EnemyFSM.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "AI/FSM/DA_EnemyArchetypeFSM.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+#include "Subsystem/WS_Perception2D.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
+
+UWS_EnemyFSM* UWS_EnemyFSM::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_EnemyFSM>() : nullptr;
+}
+
+bool UWS_EnemyFSM::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_EnemyFSM::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_EnemyFSM, STATGROUP_Tickables);
+}
+
+void UWS_EnemyFSM::Deinitialize()
+{
+	for (FAgent& A : Agents)
+	{
+		if (ACPP_EnemyParent* E = A.Cache.Enemy.Get()) E->FSMSlot = INDEX_NONE;
+	}
+	Agents.Empty();
+	DeferredAdds.Empty();
+	Stats = FEnemyFSMStats();
+	Super::Deinitialize();
+}
+
+void UWS_EnemyFSM::Add(ACPP_EnemyParent* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->FSMSlot != INDEX_NONE) return;
+
+	if (bTicking)
+	{
+		DeferredAdds.AddUnique(Enemy);
+		return;
+	}
+
+	const UDA_EnemyArchetypeFSM* Arch = Enemy->ArchetypeFSM;
+	if (!Arch || Arch->States.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[EnemyFSM] %s: archetype missing or has no states"), *Enemy->GetName());
+		return;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	FAgent& A = Agents.AddDefaulted_GetRef();
+	A.Archetype = Arch;
+	A.Cache.Bind(Enemy);
+
+	// stagger first senses so a wave activated together doesn't sense on the same frame
+	A.NextSenseTime = Now + FMath::FRand() * Arch->SenseInterval;
+
+	const int32 Initial = Arch->FindState(Arch->InitialState);
+	Enter(A, Initial != INDEX_NONE ? Initial : 0, Now);
+
+	Enemy->FSMSlot = Agents.Num() - 1;
+}
+
+void UWS_EnemyFSM::Remove(ACPP_EnemyParent* Enemy)
+{
+	if (!Enemy) return;
+	DeferredAdds.Remove(Enemy);
+	if (!Agents.IsValidIndex(Enemy->FSMSlot) || Agents[Enemy->FSMSlot].Cache.Enemy.Get() != Enemy) return;
+
+	const int32 i = Enemy->FSMSlot;
+	Agents[i].Cache.Stop();
+	Enemy->FSMSlot = INDEX_NONE;
+
+	if (bTicking)
+	{
+		// the pass may hold a reference to this agent; compact once it is done
+		Agents[i].bRemoved = true;
+		bAnyRemoved = true;
+		return;
+	}
+
+	RemoveAtSwap(i);
+}
+
+void UWS_EnemyFSM::RemoveAtSwap(int32 Index)
+{
+	Agents.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Agents.IsValidIndex(Index))
+	{
+		if (ACPP_EnemyParent* Moved = Agents[Index].Cache.Enemy.Get()) Moved->FSMSlot = Index;
+	}
+}
+
+void UWS_EnemyFSM::FlushDeferred()
+{
+	if (bAnyRemoved)
+	{
+		for (int32 i = Agents.Num() - 1; i >= 0; --i)
+		{
+			if (Agents[i].bRemoved) RemoveAtSwap(i);
+		}
+		bAnyRemoved = false;
+	}
+
+	if (DeferredAdds.Num() > 0)
+	{
+		TArray<TWeakObjectPtr<ACPP_EnemyParent>> Adds = MoveTemp(DeferredAdds);
+		for (const TWeakObjectPtr<ACPP_EnemyParent>& E : Adds)
+		{
+			Add(E.Get());
+		}
+	}
+}
+
+FName UWS_EnemyFSM::GetStateName(const ACPP_EnemyParent* Enemy) const
+{
+	if (!Enemy || !Agents.IsValidIndex(Enemy->FSMSlot)) return NAME_None;
+
+	const FAgent& A = Agents[Enemy->FSMSlot];
+	return A.Archetype->States.IsValidIndex(A.State) ? A.Archetype->States[A.State].Name : NAME_None;
+}
+
+void UWS_EnemyFSM::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[EnemyFSM] agents=%d sensed(last frame)=%d transitions=%d cost=%.3f ms bytes/agent=%d"),
+		Stats.Agents, Stats.SensedLastFrame, Stats.TransitionsLastFrame, Stats.LastFrameCostMs, Stats.BytesPerAgent);
+}
+
+void UWS_EnemyFSM::Tick(float DeltaTime)
+{
+	Stats.Agents = Agents.Num();
+	Stats.SensedLastFrame = 0;
+	Stats.TransitionsLastFrame = 0;
+	Stats.BytesPerAgent = sizeof(FAgent);
+	if (Agents.Num() == 0) return;
+
+	const double Start = FPlatformTime::Seconds();
+	UWorld* W = GetWorld();
+	const float Now = W->GetTimeSeconds();
+
+	FrameGraph = UWS_PlatformGraph2D::Get(this);
+	FramePerception = UWS_Perception2D::Get(this);
+	APawn* Player = FramePerception ? FramePerception->GetPlayerPawn() : UGameplayStatics::GetPlayerPawn(W, 0);
+	FramePlayer = Player;
+	FramePlayerLoc = Player ? (FramePerception ? FramePerception->GetPlayerLocation() : Player->GetActorLocation()) : FVector::ZeroVector;
+
+	// an action (AI_FireOnce in BP) may remove/add agents: those are deferred to FlushDeferred
+	bTicking = true;
+	for (int32 i = 0; i < Agents.Num(); ++i)
+	{
+		FAgent& A = Agents[i];
+		const ACPP_EnemyParent* E = A.Cache.Enemy.Get();
+		if (A.bRemoved || !E || !E->IsActive()) continue;
+
+		if (Now >= A.NextSenseTime)
+		{
+			Sense(A, Now);
+			A.NextSenseTime = Now + A.Archetype->SenseInterval * E->GetAISenseScale();
+			++Stats.SensedLastFrame;
+		}
+
+		for (const FEnemyFSMTransition& T : A.Archetype->States[A.State].Transitions)
+		{
+			if (!Passes(A, T, Now)) continue;
+
+			const int32 Next = A.Archetype->FindState(T.ToState);
+			if (Next != INDEX_NONE)
+			{
+				Enter(A, Next, Now);
+				++Stats.TransitionsLastFrame;
+			}
+			break;
+		}
+
+		if (A.Status == EActionStatus::Running) Step(A, Now, DeltaTime);
+	}
+	bTicking = false;
+	FlushDeferred();
+
+	FrameGraph = nullptr;
+	FramePerception = nullptr;
+	Stats.LastFrameCostMs = float((FPlatformTime::Seconds() - Start) * 1000.0);
+}
+
+// ================= sense / decide =================
+
+void UWS_EnemyFSM::Sense(FAgent& A, float Now)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	const APawn* Me = A.Cache.Pawn.Get();
+	const APawn* Player = FramePlayer.Get();
+
+	A.bHasLOS = false;
+	if (!Me || !Player)
+	{
+		A.bHasTarget = false;
+		A.Dist = 0.f;
+		return;
+	}
+
+	const FVector M = Me->GetActorLocation();
+	A.Dist = FVector::Dist(FVector(M.X, 0.f, M.Z), FVector(FramePlayerLoc.X, 0.f, FramePlayerLoc.Z));
+	A.TargetDZ = FramePlayerLoc.Z - M.Z;
+
+	// batched: the answer is from the previous ask (no result yet reads as no LOS)
+	bool bLOS = false;
+	if (FramePerception)
+	{
+		float Dist = 0.f;
+		FramePerception->QueryPlayerLOS(Me, Arch.EyeHeight, Arch.SightRange, Arch.LOSChannel, bLOS, Dist);
+	}
+
+	// same acquire / grace rules as UEnemyFSMComponent
+	if (A.Dist <= Arch.AcquireRange && (bLOS || !Arch.bRequireLOSForAcquire))
+	{
+		A.bHasTarget = true;
+		A.LastSeenTime = Now;
+	}
+	else if (Now - A.LastSeenTime > Arch.LoseTargetTime)
+	{
+		A.bHasTarget = false;
+	}
+
+	A.bHasLOS = A.bHasTarget && bLOS;
+}
+
+bool UWS_EnemyFSM::Passes(const FAgent& A, const FEnemyFSMTransition& T, float Now) const
+{
+	switch (T.Condition)
+	{
+	case EEnemyFSMCondition::Always:            return true;
+	case EEnemyFSMCondition::HasTarget:         return A.bHasTarget;
+	case EEnemyFSMCondition::NoTarget:          return !A.bHasTarget;
+	case EEnemyFSMCondition::HasLOS:            return A.bHasLOS;
+	case EEnemyFSMCondition::NoLOS:             return !A.bHasLOS;
+	case EEnemyFSMCondition::TargetCloserThan:  return A.bHasTarget && A.Dist < T.Value;
+	case EEnemyFSMCondition::TargetFartherThan: return A.bHasTarget && A.Dist > T.Value;
+	case EEnemyFSMCondition::TargetAbove:       return A.bHasTarget && A.TargetDZ > T.Value;
+	case EEnemyFSMCondition::TimeInStateOver:   return Now - A.StateEnterTime > T.Value;
+	case EEnemyFSMCondition::ActionSucceeded:   return A.Status == EActionStatus::Succeeded;
+	case EEnemyFSMCondition::ActionFailed:      return A.Status == EActionStatus::Failed;
+	case EEnemyFSMCondition::ActionDone:        return A.Status != EActionStatus::Running;
+	}
+	return false;
+}
+
+void UWS_EnemyFSM::Enter(FAgent& A, int32 StateIndex, float Now) const
+{
+	A.State = StateIndex;
+	A.StateEnterTime = Now;
+	A.PhaseTime = Now;
+	A.Status = EActionStatus::Running;
+	A.Phase = 0;
+	A.bHasGoal = false;
+}
+
+void UWS_EnemyFSM::Step(FAgent& A, float Now, float DeltaTime)
+{
+	if (!A.Cache.Pawn.IsValid()) return;
+
+	switch (A.Archetype->States[A.State].Action)
+	{
+	case EEnemyFSMAction::Idle:       StepIdle(A); break;
+	case EEnemyFSMAction::Patrol:     StepPatrol(A, Now); break;
+	case EEnemyFSMAction::Chase:      StepChase(A, Now); break;
+	case EEnemyFSMAction::HoldBand:   StepHoldBand(A); break;
+	case EEnemyFSMAction::Fire:       StepFire(A, Now); break;
+	case EEnemyFSMAction::Reposition: StepReposition(A, Now); break;
+	case EEnemyFSMAction::JumpUp:     StepJumpUp(A, Now, DeltaTime); break;
+	}
+}
+
+// ================= actions =================
+
+void UWS_EnemyFSM::StepIdle(FAgent& A)
+{
+	if (A.Phase != 0) return;
+
+	A.Cache.Stop();
+	A.Cache.SetState(EAIMovementState::Idle);
+	A.Phase = 1;
+}
+
+void UWS_EnemyFSM::StepPatrol(FAgent& A, float Now)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	const FVector Me = A.Cache.Pawn->GetActorLocation();
+
+	// Patrol2D: random same-floor point left or right
+	if (A.Phase == 0)
+	{
+		for (int32 i = 0; i < Arch.PatrolAttempts && !A.bHasGoal; ++i)
+		{
+			const float OffsetX = FMath::FRandRange(Arch.MinPatrolDistance, Arch.MaxPatrolDistance) * (FMath::RandBool() ? 1.f : -1.f);
+
+			FVector Ground;
+			if (!GroundAt(A, FVector(Me.X + OffsetX, Me.Y, Me.Z), Arch.GroundTrace, Ground)) continue;
+			if (FMath::Abs(Ground.Z + A.Cache.HalfHeight - Me.Z) > Arch.SameFloorTolerance) continue;
+
+			A.Goal = Ground;
+			A.bHasGoal = true;
+		}
+		if (!A.bHasGoal)
+		{
+			Finish(A, false);
+			return;
+		}
+		A.Phase = 1;
+	}
+
+	// MoveToLocation2D_Snap
+	if (MoveTowardX(A, A.Goal.X, Arch.AcceptRadius, EAIMovementState::Walk)) Finish(A, true);
+	else if (Now - A.StateEnterTime > Arch.MoveMaxTime) Finish(A, false);
+}
+
+void UWS_EnemyFSM::StepChase(FAgent& A, float Now)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	if (!A.bHasTarget || !FramePlayer.IsValid())
+	{
+		Finish(A, false);
+		return;
+	}
+
+	// MoveTo2D: horizontal only, success radius on XZ
+	const FVector Me = A.Cache.Pawn->GetActorLocation();
+	if (FVector::Dist(FVector(Me.X, 0.f, Me.Z), FVector(FramePlayerLoc.X, 0.f, FramePlayerLoc.Z)) <= Arch.AcceptRadius)
+	{
+		Finish(A, true);
+		return;
+	}
+
+	MoveTowardX(A, FramePlayerLoc.X, 1.f, EAIMovementState::Run);
+	if (Now - A.StateEnterTime > Arch.MoveMaxTime) Finish(A, false);
+}
+
+void UWS_EnemyFSM::StepHoldBand(FAgent& A)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	if (!A.bHasTarget || !FramePlayer.IsValid())
+	{
+		Finish(A, false);
+		return;
+	}
+
+	APawn* P = A.Cache.Pawn.Get();
+	const FVector Me = P->GetActorLocation();
+	const float d = FVector::Dist(FVector(Me.X, 0.f, Me.Z), FVector(FramePlayerLoc.X, 0.f, FramePlayerLoc.Z));
+	const float dx = FramePlayerLoc.X - Me.X;
+
+	// MaintainDistance2D: outside the band close in / back off
+	if (d > Arch.PreferMax + Arch.BandEpsilon || d < Arch.PreferMin - Arch.BandEpsilon)
+	{
+		const bool bTooFar = (d > Arch.PreferMax);
+		const float DirX = bTooFar ? FMath::Sign(dx) : -FMath::Sign(dx);
+		const EAIMovementState Gait = (bTooFar || d < Arch.PreferMin * 0.5f) ? EAIMovementState::Run : EAIMovementState::Walk;
+
+		A.bHasGoal = false;
+		A.Cache.Face(DirX);
+		P->AddMovementInput(FVector(DirX, 0.f, 0.f), 1.f);
+		A.Cache.SetState(Gait);
+		A.Cache.SetSpeedForState(Gait);
+		if (Arch.bSnapToGround) Snap(A);
+		return;
+	}
+
+	// inside the band: one strafe after each shot, otherwise done (Fire runs next)
+	if (A.bRequestStrafe && !A.bHasGoal)
+	{
+		A.bRequestStrafe = false;
+		if (!PickStrafeGoal(A))
+		{
+			Finish(A, true);
+			return;
+		}
+	}
+
+	if (A.bHasGoal)
+	{
+		if (MoveTowardX(A, A.Goal.X, Arch.StrafeEpsilon, EAIMovementState::Walk))
+		{
+			A.bHasGoal = false;
+			Finish(A, true);
+		}
+		return;
+	}
+
+	Finish(A, true);
+}
+
+void UWS_EnemyFSM::StepFire(FAgent& A, float Now)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	APawn* Me = A.Cache.Pawn.Get();
+
+	// FireIfLOS2D: LOS comes from the last sense instead of a fresh trace
+	if (!A.bHasLOS || !FramePlayer.IsValid() || A.Dist > Arch.AttackRange || Now - A.LastShotTime < Arch.FireCooldown)
+	{
+		Finish(A, false);
+		return;
+	}
+
+	if (Arch.bFaceTargetOnFire) A.Cache.Face(FramePlayerLoc.X - Me->GetActorLocation().X);
+
+	if (UFunction* Fn = Me->FindFunction(TEXT("AI_FireOnce")))
+	{
+		Me->ProcessEvent(Fn, nullptr);
+		if (A.bRemoved) return;   // BP killed / pooled us
+	}
+
+	A.LastShotTime = Now;
+	A.bRequestStrafe = Arch.bStrafeAfterShot;
+	Finish(A, true);
+}
+
+void UWS_EnemyFSM::StepReposition(FAgent& A, float Now)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	const AActor* Target = FramePlayer.Get();
+
+	// FindVantage2D: same-floor spot with LOS to the target, random among the valid ones
+	if (A.Phase == 0)
+	{
+		if (!A.bHasTarget || !Target)
+		{
+			Finish(A, false);
+			return;
+		}
+
+		const FVector Origin = A.Cache.Pawn->GetActorLocation();
+		const float Step = FMath::Max(Arch.VantageStep, 10.f);
+		const float Floor = Origin.Z - A.Cache.HalfHeight;
+
+		TArray<FVector, TInlineAllocator<32>> Candidates;
+		for (float d = Step; d <= Arch.VantageMaxDistance; d += Step)
+		{
+			for (const float Sign : { 1.f, -1.f })
+			{
+				FVector Ground;
+				if (!GroundAt(A, Origin + FVector(Sign * d, 0.f, 0.f), Arch.GroundTrace, Ground)) continue;
+				if (FMath::Abs(Ground.Z - Floor) > Arch.VantageFloorTolerance) continue;
+				if (FMath::Abs(Ground.X - Origin.X) < Arch.VantageMinDeltaX) continue;
+				if (!HasLOSFrom(A, Ground + FVector(0.f, 0.f, Arch.EyeHeight), Target)) continue;
+
+				Candidates.Add(Ground);
+			}
+		}
+
+		if (Candidates.Num() == 0)
+		{
+			Finish(A, false);
+			return;
+		}
+
+		A.Goal = Candidates[FMath::RandRange(0, Candidates.Num() - 1)];
+		A.bHasGoal = true;
+		A.Phase = 1;
+	}
+
+	if (MoveTowardX(A, A.Goal.X, Arch.AcceptRadius, EAIMovementState::Walk)) Finish(A, true);
+	else if (Now - A.StateEnterTime > Arch.MoveMaxTime) Finish(A, false);
+}
+
+void UWS_EnemyFSM::StepJumpUp(FAgent& A, float Now, float DeltaTime)
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	APawn* P = A.Cache.Pawn.Get();
+
+	// FindJumpSpot2D: takeoff under a linked ledge toward the target (graph only, no trace fallback)
+	if (A.Phase == 0)
+	{
+		if (!FrameGraph || !FrameGraph->HasData())
+		{
+			Finish(A, false);
+			return;
+		}
+
+		const FVector Origin = P->GetActorLocation();
+		const int32 Here = FrameGraph->FindSpanBelow(Origin + FVector(0.f, 0.f, 50.f), Arch.GroundTrace);
+		const float PreferX = FramePlayer.IsValid() ? FramePlayerLoc.X : Origin.X;
+
+		float TakeoffX = Origin.X;
+		const int32 Ledge = FrameGraph->FindJumpUp(Here, PreferX, Arch.MaxJumpRise, TakeoffX);
+
+		FPlatformSpan2D From, To;
+		if (!FrameGraph->GetSpan(Here, From) || !FrameGraph->GetSpan(Ledge, To)
+			|| FMath::Abs(TakeoffX - Origin.X) > Arch.JumpSearchDistance)
+		{
+			Finish(A, false);
+			return;
+		}
+
+		// JumpUp2D: v0 = sqrt(2 g h), clear the ledge top by a little
+		const float H = To.TopZ - From.TopZ + 60.f;
+		A.Vz = FMath::Min(FMath::Sqrt(FMath::Max(0.f, 2.f * Arch.Gravity * H)), Arch.MaxJumpSpeed);
+		A.Goal = FVector(TakeoffX, Origin.Y, From.TopZ);
+		A.bHasGoal = true;
+		A.Phase = 1;
+	}
+
+	if (A.Phase == 1)
+	{
+		if (!MoveTowardX(A, A.Goal.X, FMath::Min(Arch.AcceptRadius, 16.f), EAIMovementState::Walk))
+		{
+			if (Now - A.StateEnterTime > Arch.MoveMaxTime) Finish(A, false);
+			return;
+		}
+		A.Phase = 2;
+		A.PhaseTime = Now;
+	}
+
+	// airborne: integrate vertical motion, land on any span under the feet while falling
+	FVector Loc = P->GetActorLocation();
+	Loc.Z += A.Vz * DeltaTime;
+	A.Vz -= Arch.Gravity * DeltaTime;
+	P->SetActorLocation(Loc);
+
+	if (A.Vz <= 0.f && FrameGraph && FrameGraph->FindSpanBelow(Loc + FVector(0.f, 0.f, 10.f), A.Cache.HalfHeight + 15.f) != INDEX_NONE)
+	{
+		Finish(A, true);
+		return;
+	}
+	if (Now - A.PhaseTime > Arch.JumpMaxTime) Finish(A, false);
+}
+
+// ================= helpers =================
+
+bool UWS_EnemyFSM::MoveTowardX(FAgent& A, float GoalX, float Accept, EAIMovementState Gait) const
+{
+	APawn* P = A.Cache.Pawn.Get();
+	const float DX = GoalX - P->GetActorLocation().X;
+	if (FMath::Abs(DX) <= Accept) return true;
+
+	A.Cache.Face(DX);
+	P->AddMovementInput(FVector(FMath::Sign(DX), 0.f, 0.f), 1.f);
+	A.Cache.SetState(Gait);
+	A.Cache.SetSpeedForState(Gait);
+
+	if (A.Archetype->bSnapToGround) Snap(A);
+	return false;
+}
+
+void UWS_EnemyFSM::Finish(FAgent& A, bool bSucceeded) const
+{
+	A.Cache.Stop();
+	A.Cache.SetState(EAIMovementState::Idle);
+	A.Status = bSucceeded ? EActionStatus::Succeeded : EActionStatus::Failed;
+}
+
+void UWS_EnemyFSM::Snap(const FAgent& A) const
+{
+	APawn* P = A.Cache.Pawn.Get();
+	const FVector L = P->GetActorLocation();
+
+	FVector Ground;
+	if (GroundAt(A, L + FVector(0.f, 0.f, 20.f), A.Archetype->GroundTrace, Ground))
+	{
+		P->SetActorLocation(FVector(L.X, L.Y, Ground.Z + A.Cache.HalfHeight), /*bSweep=*/true);
+	}
+}
+
+bool UWS_EnemyFSM::GroundAt(const FAgent& A, const FVector& Start, float Down, FVector& OutGround) const
+{
+	// graph first; non-strip ground still needs the trace
+	if (FrameGraph && FrameGraph->HasData() && FrameGraph->GroundBelow(Start, Down, OutGround)) return true;
+
+	FHitResult Hit;
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(EnemyFSM_Ground), false, A.Cache.Pawn.Get());
+	if (GetWorld()->LineTraceSingleByChannel(Hit, Start, Start - FVector(0.f, 0.f, Down), A.Archetype->GroundChannel, Q))
+	{
+		OutGround = Hit.ImpactPoint;
+		return true;
+	}
+	return false;
+}
+
+bool UWS_EnemyFSM::HasLOSFrom(const FAgent& A, const FVector& Eye, const AActor* Target) const
+{
+	FVector D = Target->GetActorLocation() - Eye; D.Y = 0.f;
+	const float Dist = D.Size();
+	if (Dist <= KINDA_SMALL_NUMBER) return true;
+
+	FHitResult Hit;
+	FCollisionQueryParams Q(SCENE_QUERY_STAT(EnemyFSM_LOS), false, A.Cache.Pawn.Get());
+	if (!GetWorld()->LineTraceSingleByChannel(Hit, Eye, Eye + D / Dist * (Dist + 1.f), A.Archetype->LOSChannel, Q)) return true;
+	return Hit.GetActor() == Target;
+}
+
+bool UWS_EnemyFSM::PickStrafeGoal(FAgent& A) const
+{
+	const UDA_EnemyArchetypeFSM& Arch = *A.Archetype;
+	const AActor* Target = FramePlayer.Get();
+	if (!Target) return false;
+
+	// MaintainDistance2D::ChooseNewStrafeGoal
+	const FVector Me = A.Cache.Pawn->GetActorLocation();
+	const float Side = FMath::RandBool() ? 1.f : -1.f;
+	const float J = (Arch.StrafeJitter > 0.f) ? FMath::FRandRange(-Arch.StrafeJitter, Arch.StrafeJitter) : 0.f;
+
+	float DesiredX = FramePlayerLoc.X + Side * (FMath::FRandRange(Arch.PreferMin, Arch.PreferMax) + J);
+	if (FMath::Abs(DesiredX - Me.X) < Arch.MinStrafeDeltaX) DesiredX += Side * Arch.MinStrafeDeltaX;
+
+	FVector Ground;
+	const FVector Start(DesiredX, Me.Y, Me.Z + Arch.GroundTrace * 0.5f);
+	if (!GroundAt(A, Start, Arch.GroundTrace * 1.5f, Ground)) return false;
+	if (!HasLOSFrom(A, Ground + FVector(0.f, 0.f, Arch.EyeHeight), Target)) return false;
+
+	A.Goal = Ground;
+	A.bHasGoal = true;
+	return true;
+}
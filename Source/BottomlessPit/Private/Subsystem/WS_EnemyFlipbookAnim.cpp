@@ -0,0 +1,192 @@
+﻿// WS_EnemyFlipbookAnim.cpp
+
+
+#include "Subsystem/WS_EnemyFlipbookAnim.h"
+#include "Engine/World.h"
+#include "PaperFlipbook.h"
+#include "PaperFlipbookComponent.h"
+#include "AnimSequences/PaperZDAnimSequence.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+
+UWS_EnemyFlipbookAnim* UWS_EnemyFlipbookAnim::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_EnemyFlipbookAnim>() : nullptr;
+}
+
+bool UWS_EnemyFlipbookAnim::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_EnemyFlipbookAnim::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_EnemyFlipbookAnim, STATGROUP_Tickables);
+}
+
+void UWS_EnemyFlipbookAnim::Deinitialize()
+{
+	for (FEntry& En : Entries)
+	{
+		if (ACPP_EnemyParent* E = En.Enemy.Get()) E->FlipbookAnimSlot = INDEX_NONE;
+	}
+	Entries.Empty();
+	Sets.Empty();
+	SetByRow.Empty();
+	HeldFlipbooks.Empty();
+	Stats = FEnemyFlipbookAnimStats();
+	Super::Deinitialize();
+}
+
+UPaperFlipbook* UWS_EnemyFlipbookAnim::GetSequenceFlipbook(const UPaperZDAnimSequence* Sequence)
+{
+	return Sequence ? Cast<UPaperFlipbook>(Sequence->GetAnimationData(0.f)) : nullptr;
+}
+
+UPaperFlipbook* UWS_EnemyFlipbookAnim::Hold(const UPaperZDAnimSequence* Sequence)
+{
+	UPaperFlipbook* Flipbook = GetSequenceFlipbook(Sequence);
+	if (Flipbook) HeldFlipbooks.AddUnique(Flipbook);
+	return Flipbook;
+}
+
+int32 UWS_EnemyFlipbookAnim::FindOrBuildSet(const ACPP_EnemyParent* Enemy)
+{
+	const TPair<FObjectKey, FName> Key(FObjectKey(Enemy->GetAnimationDataTable()), Enemy->GetAnimationRowName());
+	if (const int32* Found = SetByRow.Find(Key)) return *Found;
+
+	const FEnemyAnimResolved& R = Enemy->ResolvedAnims;
+	FFlipbookSet Set;
+
+	auto Slot = [&Set](EAIMovementState S) -> UPaperFlipbook*& { return Set.ByState[int32(S)]; };
+	Slot(EAIMovementState::Idle)      = Hold(R.Idle);
+	Slot(EAIMovementState::Walk)      = Hold(R.Walk);
+	Slot(EAIMovementState::Run)       = R.Run ? Hold(R.Run) : Slot(EAIMovementState::Walk);
+	Slot(EAIMovementState::Aiming)    = Slot(EAIMovementState::Idle);
+	Slot(EAIMovementState::Slide)     = Hold(R.Slide);
+	Slot(EAIMovementState::Roll)      = Hold(R.Roll);
+	Slot(EAIMovementState::WallSlide) = Slot(EAIMovementState::Slide);
+	Slot(EAIMovementState::Dash)      = Hold(R.Dash);
+	Slot(EAIMovementState::Jump)      = R.Jump_Falling ? Hold(R.Jump_Falling) : Hold(R.Jump_Start);
+	Set.Death = Hold(R.Death);
+
+	const int32 Index = Sets.Add(Set);
+	SetByRow.Add(Key, Index);
+	return Index;
+}
+
+void UWS_EnemyFlipbookAnim::Add(ACPP_EnemyParent* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->FlipbookAnimSlot != INDEX_NONE || !Enemy->Sprite) return;
+
+	// row not resolved yet: the enemy adds itself again from its anim callback
+	const FEnemyAnimResolved& R = Enemy->ResolvedAnims;
+	if (!R.Idle && !R.Walk) return;
+
+	FEntry En;
+	En.Enemy = Enemy;
+	En.Sprite = Enemy->Sprite;
+	En.Set = FindOrBuildSet(Enemy);
+
+	Enemy->FlipbookAnimSlot = Entries.Add(En);
+}
+
+void UWS_EnemyFlipbookAnim::Remove(ACPP_EnemyParent* Enemy)
+{
+	if (!Enemy || !Entries.IsValidIndex(Enemy->FlipbookAnimSlot) || Entries[Enemy->FlipbookAnimSlot].Enemy.Get() != Enemy) return;
+
+	const int32 i = Enemy->FlipbookAnimSlot;
+	Enemy->FlipbookAnimSlot = INDEX_NONE;
+
+	Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	if (Entries.IsValidIndex(i))
+	{
+		if (ACPP_EnemyParent* Moved = Entries[i].Enemy.Get()) Moved->FlipbookAnimSlot = i;
+	}
+}
+
+void UWS_EnemyFlipbookAnim::Tick(float DeltaTime)
+{
+	Stats.Enemies = Entries.Num();
+	Stats.FlipbookSets = Sets.Num();
+	Stats.FrameWritesLastFrame = 0;
+	Stats.SwapsLastFrame = 0;
+	if (Entries.Num() == 0) return;
+
+	const double Start = FPlatformTime::Seconds();
+
+	// death callbacks pool the enemy (and remove it from Entries), so they run after the pass
+	TArray<TWeakObjectPtr<ACPP_EnemyParent>, TInlineAllocator<8>> DeathDone;
+
+	for (FEntry& En : Entries)
+	{
+		ACPP_EnemyParent* E = En.Enemy.Get();
+		UPaperFlipbookComponent* S = En.Sprite.Get();
+		if (!E || !S || E->IsHidden()) continue;
+
+		const FFlipbookSet& Set = Sets[En.Set];
+		const bool bDying = (E->GetLifeState() == EEnemyLifeState::Dying);
+
+		UPaperFlipbook* Want = bDying ? Set.Death : Set.ByState[int32(E->AIMoveState)];
+		if (!Want && !bDying) Want = Set.ByState[int32(EAIMovementState::Idle)];
+
+		if (Want != En.Current)
+		{
+			En.Current = Want;
+			En.Time = 0.f;
+			En.Frame = INDEX_NONE;
+			En.bDeathNotified = false;
+			if (Want) S->SetFlipbook(Want);
+			++Stats.SwapsLastFrame;
+		}
+
+		if (!Want)
+		{
+			// no death flipbook: nothing to wait for
+			if (bDying && !En.bDeathNotified)
+			{
+				En.bDeathNotified = true;
+				DeathDone.Add(E);
+			}
+			continue;
+		}
+
+		En.Time += DeltaTime;
+
+		const int32 NumFrames = FMath::Max(1, Want->GetNumFrames());
+		int32 Frame = FMath::FloorToInt(En.Time * Want->GetFramesPerSecond());
+		if (bDying)
+		{
+			if (Frame >= NumFrames && !En.bDeathNotified)
+			{
+				En.bDeathNotified = true;
+				DeathDone.Add(E);
+			}
+			Frame = FMath::Min(Frame, NumFrames - 1);
+		}
+		else
+		{
+			Frame %= NumFrames;
+		}
+
+		if (Frame != En.Frame)
+		{
+			En.Frame = Frame;
+			S->SetPlaybackPositionInFrames(Frame, /*bFireEvents*/ false);
+			++Stats.FrameWritesLastFrame;
+		}
+	}
+
+	for (const TWeakObjectPtr<ACPP_EnemyParent>& Done : DeathDone)
+	{
+		if (ACPP_EnemyParent* E = Done.Get()) E->Notify_DeathAnimFinished();
+	}
+
+	Stats.LastFrameCostMs = float((FPlatformTime::Seconds() - Start) * 1000.0);
+}
+
+void UWS_EnemyFlipbookAnim::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[EnemyFlipbookAnim] enemies=%d sets=%d frameWrites(last frame)=%d swaps=%d cost=%.3f ms"),
+		Stats.Enemies, Stats.FlipbookSets, Stats.FrameWritesLastFrame, Stats.SwapsLastFrame, Stats.LastFrameCostMs);
+}
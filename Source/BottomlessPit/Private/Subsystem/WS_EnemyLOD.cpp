@@ -0,0 +1,238 @@
+﻿// WS_EnemyLOD.cpp
+
+
+#include "Subsystem/WS_EnemyLOD.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Pawn/Enemy/CPP_EnemyParent.h"
+#include "Subsystem/WS_SpatialHash2D.h"
+
+UWS_EnemyLOD* UWS_EnemyLOD::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_EnemyLOD>() : nullptr;
+}
+
+bool UWS_EnemyLOD::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_EnemyLOD::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_EnemyLOD, STATGROUP_Tickables);
+}
+
+void UWS_EnemyLOD::Deinitialize()
+{
+	Enemies.Empty();
+	Super::Deinitialize();
+}
+
+void UWS_EnemyLOD::Configure(const FEnemyLODSettings& InSettings)
+{
+	Settings = InSettings;
+	SinceRebucket = Settings.RebucketInterval;   // re-apply on the next tick with the new rates
+
+	// new intervals for enemies already sitting in a reduced bucket
+	for (ACPP_EnemyParent* E : Enemies)
+	{
+		if (IsValid(E) && E->GetTickLOD() != EEnemyTickLOD::Near) Apply(E, E->GetTickLOD());
+	}
+}
+
+void UWS_EnemyLOD::SetEnabled(bool bInEnabled)
+{
+	bEnabled = bInEnabled;
+	if (bEnabled) return;
+
+	for (ACPP_EnemyParent* E : Enemies)
+	{
+		if (IsValid(E) && E->GetTickLOD() != EEnemyTickLOD::Near) Apply(E, EEnemyTickLOD::Near);
+	}
+	Stats = FEnemyLODStats();
+}
+
+void UWS_EnemyLOD::Register(ACPP_EnemyParent* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+	Enemies.AddUnique(Enemy);
+}
+
+void UWS_EnemyLOD::Unregister(ACPP_EnemyParent* Enemy)
+{
+	if (!Enemy) return;
+	Enemies.RemoveSwap(Enemy, EAllowShrinking::No);
+
+	// pooled enemies come back at full rate
+	if (Enemy->GetTickLOD() != EEnemyTickLOD::Near) Apply(Enemy, EEnemyTickLOD::Near);
+}
+
+void UWS_EnemyLOD::Tick(float DeltaTime)
+{
+	if (!bEnabled) return;
+	if (DeltaTime > KINDA_SMALL_NUMBER) SmoothedFPS = FMath::Lerp(SmoothedFPS, 1.f / DeltaTime, 0.05f);
+
+	RefreshThrottledHash();
+
+	SinceRebucket += DeltaTime;
+	if (SinceRebucket < Settings.RebucketInterval || Enemies.Num() == 0) return;
+	SinceRebucket = 0.f;
+
+	Rebucket();
+}
+
+bool UWS_EnemyLOD::GetVisibleBand(FVector2D& OutCenter, FVector2D& OutHalf) const
+{
+	const APlayerCameraManager* PCM = UGameplayStatics::GetPlayerCameraManager(this, 0);
+	if (!PCM) return false;
+
+	const FMinimalViewInfo& View = PCM->GetCameraCacheView();
+
+	float Aspect = View.AspectRatio > KINDA_SMALL_NUMBER ? View.AspectRatio : 16.f / 9.f;
+	if (GEngine && GEngine->GameViewport)
+	{
+		FVector2D Size;
+		GEngine->GameViewport->GetViewportSize(Size);
+		if (Size.Y > 0.f) Aspect = Size.X / Size.Y;
+	}
+
+	float HalfW = 0.f;
+	if (View.ProjectionMode == ECameraProjectionMode::Orthographic)
+	{
+		HalfW = 0.5f * View.OrthoWidth;
+	}
+	else
+	{
+		// distance from the camera to the gameplay plane (the player's Y)
+		const APawn* Player = UGameplayStatics::GetPlayerPawn(this, 0);
+		const float PlaneY = Player ? Player->GetActorLocation().Y : 0.f;
+		const float Depth = FMath::Max(FMath::Abs(PlaneY - View.Location.Y), 1.f);
+		HalfW = Depth * FMath::Tan(FMath::DegreesToRadians(0.5f * View.FOV));
+	}
+
+	OutCenter = FVector2D(View.Location.X, View.Location.Z);
+	OutHalf = FVector2D(HalfW, HalfW / Aspect);
+	return HalfW > 0.f;
+}
+
+void UWS_EnemyLOD::Rebucket()
+{
+	for (int32 i = Enemies.Num() - 1; i >= 0; --i)
+	{
+		if (!IsValid(Enemies[i])) Enemies.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+
+	FVector2D C, H;
+	if (!GetVisibleBand(C, H)) return;   // no camera yet: keep the current buckets
+
+	const float MidReach = Settings.OnScreenMarginUU + Settings.MidBandScreens * 2.f * H.Y;
+
+	TArray<EEnemyTickLOD> Want;
+	Want.SetNumUninitialized(Enemies.Num());
+	TArray<TPair<float, int32>> OnScreen;   // (dist^2 to view center, index)
+
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		const FVector P = Enemies[i]->GetActorLocation();
+		const float Dx = P.X - C.X;
+		const float Dz = P.Z - C.Y;
+		const float Outside = FMath::Max(FMath::Abs(Dx) - H.X, FMath::Abs(Dz) - H.Y);
+
+		if (Outside <= Settings.OnScreenMarginUU)
+		{
+			Want[i] = EEnemyTickLOD::Near;
+			OnScreen.Emplace(Dx * Dx + Dz * Dz, i);
+		}
+		else
+		{
+			Want[i] = Outside <= MidReach ? EEnemyTickLOD::Mid : EEnemyTickLOD::Far;
+		}
+	}
+
+	// on-screen budget: the furthest from the view center run at Mid rates
+	int32 OverBudget = 0;
+	if (OnScreen.Num() > Settings.MaxNearOnScreen)
+	{
+		OnScreen.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+		for (int32 k = Settings.MaxNearOnScreen; k < OnScreen.Num(); ++k)
+		{
+			Want[OnScreen[k].Value] = EEnemyTickLOD::Mid;
+			++OverBudget;
+		}
+	}
+
+	FEnemyLODStats S;
+	S.OverBudget = OverBudget;
+
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		ACPP_EnemyParent* E = Enemies[i];
+		if (E->GetTickLOD() != Want[i]) Apply(E, Want[i]);
+
+		switch (Want[i])
+		{
+		case EEnemyTickLOD::Near: ++S.Near; break;
+		case EEnemyTickLOD::Mid:  ++S.Mid;  break;
+		case EEnemyTickLOD::Far:  ++S.Far;  break;
+		}
+
+		const float Interval = IntervalFor(Want[i]);
+		if (Interval > 0.f)
+		{
+			// only ticks that would run at all; WS_EnemySim and the flipbook fast path already switched some off
+			S.TicksSkippedPerSec += E->CountLODTickingComponents() * FMath::Max(0.f, SmoothedFPS - 1.f / Interval);
+		}
+	}
+
+	// not measured: skipped ticks priced at the configured per-tick cost
+	S.EstMsSavedPerSec = S.TicksSkippedPerSec * Settings.AssumedTickCostUs * 0.001f;
+	Stats = S;
+}
+
+void UWS_EnemyLOD::RefreshThrottledHash() const
+{
+	// throttled actor ticks would leave the hash entry up to one interval of movement behind (projectile broadphase)
+	UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this);
+	if (!Hash) return;
+
+	for (const ACPP_EnemyParent* E : Enemies)
+	{
+		if (IsValid(E) && E->GetTickLOD() != EEnemyTickLOD::Near) Hash->UpdateActor(E);
+	}
+}
+
+void UWS_EnemyLOD::Apply(ACPP_EnemyParent* Enemy, EEnemyTickLOD LOD) const
+{
+	Enemy->ApplyTickLOD(LOD, IntervalFor(LOD), SenseScaleFor(LOD));
+}
+
+float UWS_EnemyLOD::IntervalFor(EEnemyTickLOD LOD) const
+{
+	switch (LOD)
+	{
+	case EEnemyTickLOD::Mid: return Settings.MidTickInterval;
+	case EEnemyTickLOD::Far: return Settings.FarTickInterval;
+	default:                 return 0.f;
+	}
+}
+
+float UWS_EnemyLOD::SenseScaleFor(EEnemyTickLOD LOD) const
+{
+	switch (LOD)
+	{
+	case EEnemyTickLOD::Mid: return FMath::Max(1.f, Settings.MidSenseScale);
+	case EEnemyTickLOD::Far: return FMath::Max(1.f, Settings.FarSenseScale);
+	default:                 return 1.f;
+	}
+}
+
+void UWS_EnemyLOD::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[EnemyLOD] near=%d mid=%d far=%d overBudget=%d skippedTicks/s=%.0f estimated saving=%.2f ms/s (at %.1f us/tick, assumed)"),
+		Stats.Near, Stats.Mid, Stats.Far, Stats.OverBudget, Stats.TicksSkippedPerSec, Stats.EstMsSavedPerSec,
+		Settings.AssumedTickCostUs);
+}
@@ -0,0 +1,330 @@
+﻿// WS_EnemySim.cpp
+
+
+#include "Subsystem/WS_EnemySim.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/FloatingPawnMovement.h"
+#include "Pawn/Enemy/CPP_BlpEnemies.h"
+#include "Actor/LevelActor/PlatformStrip.h"
+#include "Actor/LevelActor/LaneLevelGenerator.h"
+#include "Subsystem/WS_SpatialHash2D.h"
+
+UWS_EnemySim* UWS_EnemySim::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_EnemySim>() : nullptr;
+}
+
+bool UWS_EnemySim::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_EnemySim::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_EnemySim, STATGROUP_Tickables);
+}
+
+void UWS_EnemySim::Deinitialize()
+{
+	while (Enemies.Num() > 0) RemoveAtSwap(Enemies.Num() - 1);
+	Super::Deinitialize();
+}
+
+// --------------------------- Registration ---------------------------
+
+void UWS_EnemySim::Add(ACPP_BlpEnemies* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->SimSlot != INDEX_NONE) return;
+
+	const int32 i = Enemies.Add(Enemy);
+	Enemy->SimSlot = i;
+
+	const UCapsuleComponent* Cap = Enemy->FindComponentByClass<UCapsuleComponent>();
+
+	bIsWalker.Add(Enemy->Kind == EBPEnemyKind::Walker ? 1 : 0);
+	Axis.Add(Enemy->AxisVec);
+	Speed.Add(Enemy->MoveSpeed);
+	HalfHeight.Add(Cap ? Cap->GetScaledCapsuleHalfHeight() : 44.f);
+	WallLookAhead.Add(Enemy->WallLookAheadUU);
+	GroundAhead.Add(Enemy->GroundAheadUU);
+	GroundDown.Add(Enemy->GroundDownUU);
+	MinNormalZ.Add(Enemy->WalkableMinNormalZ);
+	HoverAmp.Add(Enemy->HoverAmp);
+	HoverHz.Add(Enemy->HoverHz);
+	FlipCooldownSeconds.Add(Enemy->FlipCooldownSeconds);
+	Channel.Add(Enemy->GroundChannel);
+
+	Dir.Add(Enemy->Dir);
+	FlipCooldown.Add(Enemy->FlipCooldown);
+	BaseZ.Add(Enemy->BaseZ);
+	Strip.AddDefaulted();
+	Span.AddDefaulted();
+
+	bLive.AddZeroed();
+	Pos.Add(Enemy->GetActorLocation());
+	GroundZ.Add(NAN);
+	bGroundAhead.AddZeroed();
+	bWall.AddZeroed();
+	Yaw.Add(Enemy->GetActorRotation().Yaw);
+}
+
+void UWS_EnemySim::Remove(ACPP_BlpEnemies* Enemy)
+{
+	if (!Enemy || !Enemies.IsValidIndex(Enemy->SimSlot) || Enemies[Enemy->SimSlot] != Enemy) return;
+
+	// hand the live state back so a non-sim tick could pick up where we left off
+	const int32 i = Enemy->SimSlot;
+	Enemy->Dir = Dir[i];
+	Enemy->FlipCooldown = FlipCooldown[i];
+
+	RemoveAtSwap(i);
+}
+
+void UWS_EnemySim::RemoveAtSwap(int32 Index)
+{
+	if (ACPP_BlpEnemies* Gone = Enemies[Index]) Gone->SimSlot = INDEX_NONE;
+
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	bIsWalker.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Axis.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Speed.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HalfHeight.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	WallLookAhead.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GroundAhead.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GroundDown.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MinNormalZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HoverAmp.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HoverHz.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	FlipCooldownSeconds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Channel.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Dir.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	FlipCooldown.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	BaseZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Strip.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Span.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	bLive.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Pos.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GroundZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	bGroundAhead.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	bWall.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Yaw.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	// the enemy that moved into Index keeps its slot in sync
+	if (Enemies.IsValidIndex(Index) && Enemies[Index]) Enemies[Index]->SimSlot = Index;
+}
+
+void UWS_EnemySim::BindStrip(ACPP_BlpEnemies* Enemy, APlatformStrip* InStrip)
+{
+	if (!Enemy || !InStrip || !Enemies.IsValidIndex(Enemy->SimSlot) || Enemies[Enemy->SimSlot] != Enemy) return;
+
+	// spans are along world X; lane-Y walkers keep tracing
+	const int32 i = Enemy->SimSlot;
+	if (!bIsWalker[i] || FMath::Abs(Axis[i].X) < 0.5f) return;
+
+	Strip[i] = InStrip;
+	if (!RefreshSpan(i)) return;
+
+	if (!InStrip->OnSpansChanged.IsBoundToObject(this))
+	{
+		InStrip->OnSpansChanged.AddUObject(this, &UWS_EnemySim::HandleStripSpansChanged);
+	}
+}
+
+bool UWS_EnemySim::RefreshSpan(int32 i)
+{
+	const APlatformStrip* S = Strip[i].Get();
+	float MinX = 0.f, MaxX = 0.f, TopZ = 0.f;
+	if (!S || !S->GetSolidSpanAtWorldX(Enemies[i]->GetActorLocation().X, MinX, MaxX, TopZ))
+	{
+		// standing over a hole (or strip gone): fall back to traces
+		Strip[i].Reset();
+		return false;
+	}
+
+	const FVector O = S->GetActorLocation();
+	Span[i].MinDX = MinX - O.X;
+	Span[i].MaxDX = MaxX - O.X;
+	Span[i].TopDZ = TopZ - O.Z;
+	return true;
+}
+
+void UWS_EnemySim::HandleStripSpansChanged(APlatformStrip* ChangedStrip)
+{
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		if (Strip[i].Get() == ChangedStrip && IsValid(Enemies[i])) RefreshSpan(i);
+	}
+}
+
+// --------------------------- Frame ---------------------------
+
+void UWS_EnemySim::Tick(float DeltaTime)
+{
+	if (Enemies.Num() == 0 || DeltaTime <= 0.f) return;
+
+	// drop anything destroyed behind our back
+	for (int32 i = Enemies.Num() - 1; i >= 0; --i)
+	{
+		if (!IsValid(Enemies[i])) RemoveAtSwap(i);
+	}
+
+	ProbeSerial();
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (Enemies.Num() >= ParallelThreshold)
+	{
+		ParallelFor(Enemies.Num(), [this, DeltaTime, Now](int32 i) { StepMath(i, DeltaTime, Now); });
+	}
+	else
+	{
+		for (int32 i = 0; i < Enemies.Num(); ++i) StepMath(i, DeltaTime, Now);
+	}
+
+	ApplySerial();
+}
+
+void UWS_EnemySim::ProbeSerial()
+{
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		const ACPP_BlpEnemies* E = Enemies[i];
+		bLive[i] = (E->IsActive() && E->bAIOn) ? 1 : 0;
+		if (!bLive[i]) continue;
+
+		FVector P = E->GetActorLocation();
+		Pos[i] = P;
+		GroundZ[i] = NAN;
+
+		if (bIsWalker[i])
+		{
+			if (const APlatformStrip* S = Strip[i].Get())
+			{
+				// bound walker: ground height and edges come straight from the strip span
+				const FVector O = S->GetActorLocation();
+				const float AheadX = P.X + Axis[i].X * float(Dir[i]) * GroundAhead[i];
+				GroundZ[i] = O.Z + Span[i].TopDZ;
+				bGroundAhead[i] = (AheadX >= O.X + Span[i].MinDX && AheadX <= O.X + Span[i].MaxDX) ? 1 : 0;
+				bWall[i] = IndexWall(i, P, S) ? 1 : 0;
+				continue;
+			}
+
+			// same probe order as ACPP_BlpEnemies::WalkerTick: snap, then look ahead from the snapped point
+			float Z = 0.f;
+			if (TraceWalkable(i, P, Z))
+			{
+				GroundZ[i] = Z;
+				P.Z = Z + HalfHeight[i] + 0.5f;
+			}
+
+			float AheadZ = 0.f;
+			bGroundAhead[i] = TraceWalkable(i, P + Axis[i] * float(Dir[i]) * GroundAhead[i], AheadZ) ? 1 : 0;
+		}
+
+		bWall[i] = TraceWall(i, P) ? 1 : 0;
+	}
+}
+
+void UWS_EnemySim::StepMath(int32 i, float Dt, float Now)
+{
+	if (!bLive[i]) return;
+
+	FVector P = Pos[i];
+	FlipCooldown[i] = FMath::Max(0.f, FlipCooldown[i] - Dt);
+
+	if (bIsWalker[i])
+	{
+		if (!FMath::IsNaN(GroundZ[i])) P.Z = GroundZ[i] + HalfHeight[i] + 0.5f;
+
+		if (FlipCooldown[i] <= 0.f && (!bGroundAhead[i] || bWall[i]))
+		{
+			Dir[i] = -Dir[i];
+			FlipCooldown[i] = FlipCooldownSeconds[i];
+			P += Axis[i] * float(Dir[i]) * 2.f;
+		}
+	}
+	else
+	{
+		if (FlipCooldown[i] <= 0.f && bWall[i])
+		{
+			Dir[i] = -Dir[i];
+			FlipCooldown[i] = FlipCooldownSeconds[i];
+			P += Axis[i] * float(Dir[i]) * 2.f;
+		}
+
+		if (HoverAmp[i] > 0.f && HoverHz[i] > 0.f)
+		{
+			P.Z = BaseZ[i] + HoverAmp[i] * FMath::Sin(2.f * PI * HoverHz[i] * Now);
+		}
+	}
+
+	P += Axis[i] * float(Dir[i]) * Speed[i] * Dt;
+	Pos[i] = P;
+
+	// facing: lane X -> 0/180, lane Y -> +-90
+	const bool bAxisX = FMath::Abs(Axis[i].X) >= FMath::Abs(Axis[i].Y);
+	Yaw[i] = bAxisX ? (Dir[i] > 0 ? 0.f : 180.f) : (Dir[i] > 0 ? 90.f : -90.f);
+}
+
+void UWS_EnemySim::ApplySerial()
+{
+	UWS_SpatialHash2D* Hash = UWS_SpatialHash2D::Get(this);
+
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		if (!bLive[i]) continue;
+		ACPP_BlpEnemies* E = Enemies[i];
+
+		FRotator R = E->GetActorRotation();
+		R.Yaw = Yaw[i];
+		E->SetActorLocationAndRotation(Pos[i], R, false, nullptr, ETeleportType::None);
+
+		if (Hash) Hash->UpdateActor(E);
+	}
+}
+
+// --------------------------- Probes ---------------------------
+
+bool UWS_EnemySim::TraceWalkable(int32 i, const FVector& At, float& OutZ) const
+{
+	const FVector Start(At.X, At.Y, At.Z + 80.f);
+	const FVector End = Start + FVector(0, 0, -GroundDown[i] - 120.f);
+
+	FHitResult Hit;
+	const FCollisionQueryParams P(SCENE_QUERY_STAT(EnemySim_Ground), false, Enemies[i]);
+
+	if (GetWorld()->LineTraceSingleByChannel(Hit, Start, End, Channel[i], P)
+		&& Hit.bBlockingHit && Hit.ImpactNormal.Z >= MinNormalZ[i])
+	{
+		OutZ = Hit.ImpactPoint.Z;
+		return true;
+	}
+	return false;
+}
+
+bool UWS_EnemySim::IndexWall(int32 i, const FVector& From, const APlatformStrip* BoundStrip) const
+{
+	// same segment as TraceWall, against the generator's strip boxes + side walls (no physics)
+	const ALaneLevelGenerator* Gen = Cast<ALaneLevelGenerator>(BoundStrip->GetOwner());
+	if (!Gen) return TraceWall(i, From);
+
+	const FVector Start = From + FVector(0, 0, 8.f);
+	const FVector End = Start + Axis[i] * float(Dir[i]) * WallLookAhead[i];
+
+	FHitResult Hit;
+	return Gen->SweepCollisionIndex(Start, End, 0.f, Hit) && FMath::Abs(Hit.ImpactNormal.Z) < 0.4f;
+}
+
+bool UWS_EnemySim::TraceWall(int32 i, const FVector& From) const
+{
+	const FVector Start = From + FVector(0, 0, 8.f);
+	const FVector End = Start + Axis[i] * float(Dir[i]) * WallLookAhead[i];
+
+	FHitResult Hit;
+	const FCollisionQueryParams P(SCENE_QUERY_STAT(EnemySim_Wall), false, Enemies[i]);
+
+	return GetWorld()->LineTraceSingleByChannel(Hit, Start, End, Channel[i], P)
+		&& Hit.bBlockingHit && FMath::Abs(Hit.ImpactNormal.Z) < 0.4f;
+}
@@ -0,0 +1,220 @@
+﻿// WS_FVXPool.cpp
+
+
+#include "Subsystem/WS_FVXPool.h"
+#include "Engine/World.h"
+#include "Engine/DataTable.h"
+#include "Actor/CPP_FVX.h"
+#include "Subsystem/WS_VFXRowCache.h"
+#include "Subsystem/WS_ImpactBatch.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "GameFramework/Character.h"
+
+UWS_FVXPool* UWS_FVXPool::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_FVXPool>() : nullptr;
+}
+
+bool UWS_FVXPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWS_FVXPool::Deinitialize()
+{
+	Rows.Empty();
+	Instances.Empty();
+	Super::Deinitialize();
+}
+
+// --------------------------- Prewarm ---------------------------
+
+void UWS_FVXPool::Prewarm(TSubclassOf<ACPP_FVX> FVXClass, UDataTable* VFXTable, int32 PerRow)
+{
+	if (!FVXClass || !IsValid(VFXTable))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[FVXPool] Prewarm: missing class or table"));
+		return;
+	}
+
+	PoolClass = FVXClass;
+	PoolTable = VFXTable;
+
+	// rows resolve once for every instance; first play does not wait on a stream
+	if (UWS_VFXRowCache* Cache = UWS_VFXRowCache::Get(this)) Cache->PreloadTable(VFXTable);
+
+	const int32 Count = FMath::Max(1, PerRow);
+	for (const FName& RowName : VFXTable->GetRowNames())
+	{
+		FRowPool& Pool = Rows.FindOrAdd(RowName);
+		while (Pool.Stats.Instances < Count)
+		{
+			ACPP_FVX* FVX = SpawnInstance(RowName);
+			if (!FVX) break;
+			Pool.Free.Add(FVX);
+		}
+	}
+}
+
+ACPP_FVX* UWS_FVXPool::SpawnInstance(FName RowName)
+{
+	UWorld* World = GetWorld();
+	if (!World || !PoolClass) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ACPP_FVX* FVX = World->SpawnActor<ACPP_FVX>(PoolClass, FTransform::Identity, Params);
+	if (!FVX) return nullptr;
+
+	if (!FVX->VFXDataTable) FVX->VFXDataTable = PoolTable;
+	FVX->PoolRow = RowName;
+	FVX->SetActorHiddenInGame(true);
+	FVX->SetActorTickEnabled(false);
+
+	Instances.Add(FVX);
+	++Rows.FindOrAdd(RowName).Stats.Instances;
+	return FVX;
+}
+
+// --------------------------- Acquire / Release ---------------------------
+
+ACPP_FVX* UWS_FVXPool::Acquire(FName RowName)
+{
+	FRowPool* Pool = Rows.Find(RowName);
+	if (!Pool) return nullptr;
+
+	ACPP_FVX* FVX = nullptr;
+	while (!FVX && Pool->Free.Num() > 0)
+	{
+		FVX = Pool->Free.Pop(EAllowShrinking::No).Get();
+	}
+
+	// exhausted: reuse the oldest live effect rather than spawn mid-combat
+	if (!FVX) FVX = StealOldest(*Pool);
+
+	// nothing live either (instances were destroyed): grow by one
+	if (!FVX) FVX = SpawnInstance(RowName);
+	if (!FVX) return nullptr;
+
+	MarkLive(*Pool, FVX);
+	return FVX;
+}
+
+void UWS_FVXPool::Release(ACPP_FVX* FVX)
+{
+	if (!FVX || !FVX->bPoolLive) return;
+	FVX->bPoolLive = false;
+
+	FRowPool* Pool = Rows.Find(FVX->PoolRow);
+	if (!Pool) return;
+
+	Pool->Stats.Live = FMath::Max(0, Pool->Stats.Live - 1);
+	Pool->Free.Add(FVX);
+}
+
+void UWS_FVXPool::MarkLive(FRowPool& Pool, ACPP_FVX* FVX)
+{
+	FVX->PoolSerial = NextSerial++;
+	FVX->bPoolLive = true;
+	Pool.LiveFifo.Emplace(FVX, FVX->PoolSerial);
+
+	++Pool.Stats.Live;
+	Pool.Stats.Peak = FMath::Max(Pool.Stats.Peak, Pool.Stats.Live);
+
+	CompactFifo(Pool);
+}
+
+ACPP_FVX* UWS_FVXPool::StealOldest(FRowPool& Pool)
+{
+	while (Pool.FifoHead < Pool.LiveFifo.Num())
+	{
+		const TPair<TWeakObjectPtr<ACPP_FVX>, uint32> Entry = Pool.LiveFifo[Pool.FifoHead++];
+		ACPP_FVX* FVX = Entry.Key.Get();
+		if (!FVX || !FVX->bPoolLive || FVX->PoolSerial != Entry.Value) continue;
+
+		// not live anymore, so DeActivateVFX's Release is a no-op
+		FVX->bPoolLive = false;
+		--Pool.Stats.Live;
+		++Pool.Stats.Steals;
+		FVX->DeActivateVFX();
+		return FVX;
+	}
+	return nullptr;
+}
+
+void UWS_FVXPool::CompactFifo(FRowPool& Pool)
+{
+	// Finished effects leave stale entries behind and steals leave a consumed prefix (FifoHead);
+	// compact once either outgrows the instance count so the array stays bounded under exhaustion
+	const int32 Limit = FMath::Max(16, Pool.Stats.Instances);
+	const int32 Pending = Pool.LiveFifo.Num() - Pool.FifoHead;
+	if (Pool.FifoHead <= Limit && Pending <= Limit * 2) return;
+
+	int32 Write = 0;
+	for (int32 i = Pool.FifoHead; i < Pool.LiveFifo.Num(); ++i)
+	{
+		const ACPP_FVX* FVX = Pool.LiveFifo[i].Key.Get();
+		if (FVX && FVX->bPoolLive && FVX->PoolSerial == Pool.LiveFifo[i].Value)
+		{
+			Pool.LiveFifo[Write++] = Pool.LiveFifo[i];
+		}
+	}
+	Pool.LiveFifo.SetNum(Write, EAllowShrinking::No);
+	Pool.FifoHead = 0;
+}
+
+// --------------------------- Play helpers ---------------------------
+
+void UWS_FVXPool::PlayAtLocation(FName RowName, const FVector& WorldLocation)
+{
+	// Instanced impact registered for this row: no actor at all
+	if (UWS_ImpactBatch* Batch = UWS_ImpactBatch::Get(this); Batch && Batch->HasType(RowName))
+	{
+		// same facing as ACPP_FVX::ActivateVFXByName
+		const ACharacter* Player = UGameplayStatics::GetPlayerCharacter(this, 0);
+		const FVector From = Player ? Player->GetActorLocation() : WorldLocation;
+		const FRotator Face = UKismetMathLibrary::FindLookAtRotation(From, WorldLocation);
+		Batch->Spawn(RowName, FTransform(Face, WorldLocation));
+		return;
+	}
+
+	if (ACPP_FVX* FVX = Acquire(RowName))
+	{
+		FVX->ActivateVFXByName(RowName, WorldLocation);
+	}
+}
+
+void UWS_FVXPool::PlayWithTransform(FName RowName, const FTransform& WorldTransform)
+{
+	if (UWS_ImpactBatch* Batch = UWS_ImpactBatch::Get(this); Batch && Batch->HasType(RowName))
+	{
+		Batch->Spawn(RowName, WorldTransform);
+		return;
+	}
+
+	if (ACPP_FVX* FVX = Acquire(RowName))
+	{
+		FVX->ActivateVFXByNameTransform(RowName, WorldTransform);
+	}
+}
+
+// --------------------------- Stats ---------------------------
+
+FFVXPoolStats UWS_FVXPool::GetRowStats(FName RowName) const
+{
+	const FRowPool* Pool = Rows.Find(RowName);
+	return Pool ? Pool->Stats : FFVXPoolStats();
+}
+
+void UWS_FVXPool::LogStats() const
+{
+	for (const TPair<FName, FRowPool>& It : Rows)
+	{
+		const FFVXPoolStats& S = It.Value.Stats;
+		UE_LOG(LogTemp, Log, TEXT("[FVXPool] %s: instances=%d live=%d peak=%d steals=%d"),
+			*It.Key.ToString(), S.Instances, S.Live, S.Peak, S.Steals);
+	}
+}
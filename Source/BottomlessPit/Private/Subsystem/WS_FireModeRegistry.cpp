@@ -0,0 +1,191 @@
+﻿// WS_FireModeRegistry.cpp
+
+
+#include "Subsystem/WS_FireModeRegistry.h"
+#include "Engine/World.h"
+#include "Engine/DataTable.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "PaperSprite.h"
+#include "Actor/CPP_ProjectileParent.h"
+
+UWS_FireModeRegistry* UWS_FireModeRegistry::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_FireModeRegistry>() : nullptr;
+}
+
+bool UWS_FireModeRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWS_FireModeRegistry::Deinitialize()
+{
+	if (Handle.IsValid())
+	{
+		Handle->CancelHandle();
+		Handle.Reset();
+	}
+	Resolved.Empty();
+	HeldAssets.Empty();
+	Pools.Empty();
+	PooledMode.Empty();
+	bReady = false;
+	Super::Deinitialize();
+}
+
+// --------------------------- Build ---------------------------
+
+void UWS_FireModeRegistry::BuildFromTable(UDataTable* Table, int32 PrewarmPerMode)
+{
+	if (!IsValid(Table))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FireModeRegistry: no table"));
+		return;
+	}
+
+	if (Handle.IsValid())
+	{
+		Handle->CancelHandle();
+		Handle.Reset();
+	}
+
+	SourceTable = Table;
+	PendingPrewarm = FMath::Max(0, PrewarmPerMode);
+	bReady = false;
+
+	// One request for every row's soft refs
+	TArray<FSoftObjectPath> Paths;
+	Table->ForeachRow<FFireModeRow>(TEXT("FireModeRegistry"), [&Paths](const FName&, const FFireModeRow& Row)
+		{
+			const FSoftObjectPath Sprite = Row.PickupSprite.ToSoftObjectPath();
+			if (Sprite.IsValid()) Paths.AddUnique(Sprite);
+
+			const FSoftObjectPath Cls = Row.ProjectileClass.ToSoftObjectPath();
+			if (Cls.IsValid()) Paths.AddUnique(Cls);
+		});
+
+	if (Paths.Num() == 0)
+	{
+		FinishBuild();
+		return;
+	}
+
+	// Held (not released in the callback): keeps everything resident for the session
+	Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths,
+		FStreamableDelegate::CreateUObject(this, &UWS_FireModeRegistry::FinishBuild),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+
+	if (!Handle.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("FireModeRegistry: streamable request failed"));
+	}
+}
+
+void UWS_FireModeRegistry::FinishBuild()
+{
+	if (!IsValid(SourceTable)) return;
+
+	Resolved.Reset();
+	HeldAssets.Reset();
+
+	SourceTable->ForeachRow<FFireModeRow>(TEXT("FireModeRegistry"), [this](const FName& RowName, const FFireModeRow& Row)
+		{
+			FFireModeResolved& R = Resolved.Add(RowName);
+			R.PickupSprite = Row.PickupSprite.Get();
+			R.ProjectileClass = Row.ProjectileClass.Get();
+			R.Profile = Row.Profile;
+
+			if (R.PickupSprite) HeldAssets.AddUnique(R.PickupSprite);
+			if (R.ProjectileClass) HeldAssets.AddUnique(R.ProjectileClass);
+		});
+
+	bReady = true;
+
+	for (const TPair<FName, FFireModeResolved>& It : Resolved)
+	{
+		PrewarmPool(It.Key, PendingPrewarm);
+	}
+
+	OnRegistryReady.Broadcast(Resolved.Num());
+}
+
+bool UWS_FireModeRegistry::FindFireMode(FName RowName, FFireModeResolved& OutResolved) const
+{
+	if (!bReady) return false;
+
+	const FFireModeResolved* Found = Resolved.Find(RowName);
+	if (!Found) return false;
+
+	OutResolved = *Found;
+	return true;
+}
+
+// --------------------------- Projectile pools ---------------------------
+
+void UWS_FireModeRegistry::PrewarmPool(FName RowName, int32 Count)
+{
+	const FFireModeResolved* R = Resolved.Find(RowName);
+	UClass* Cls = R ? R->ProjectileClass : nullptr;
+	if (!Cls || !Cls->IsChildOf(ACPP_ProjectileParent::StaticClass())) return;
+
+	FFireModeProjectilePool& Pool = Pools.FindOrAdd(RowName);
+	while (Pool.Free.Num() < Count)
+	{
+		ACPP_ProjectileParent* P = SpawnPooled(RowName, Cls);
+		if (!P) break;
+		Pool.Free.Add(P);
+	}
+}
+
+ACPP_ProjectileParent* UWS_FireModeRegistry::SpawnPooled(FName RowName, UClass* Cls)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// Constructor leaves it hidden with collision off; FireFrom arms it
+	ACPP_ProjectileParent* P = World->SpawnActor<ACPP_ProjectileParent>(Cls, FTransform::Identity, Params);
+	if (!P) return nullptr;
+
+	P->OnDeactivated.AddUniqueDynamic(this, &UWS_FireModeRegistry::HandleProjectileDeactivated);
+	PooledMode.Add(P, RowName);
+	++Pools.FindOrAdd(RowName).Spawned;
+	return P;
+}
+
+ACPP_ProjectileParent* UWS_FireModeRegistry::AcquireProjectile(FName RowName, AActor* InOwner)
+{
+	const FFireModeResolved* R = bReady ? Resolved.Find(RowName) : nullptr;
+	UClass* Cls = R ? R->ProjectileClass : nullptr;
+	if (!Cls || !Cls->IsChildOf(ACPP_ProjectileParent::StaticClass())) return nullptr;
+
+	ACPP_ProjectileParent* P = nullptr;
+	FFireModeProjectilePool& Pool = Pools.FindOrAdd(RowName);
+	while (Pool.Free.Num() > 0 && !P)
+	{
+		P = Pool.Free.Pop(EAllowShrinking::No);
+		if (!IsValid(P)) P = nullptr;
+	}
+
+	// Pool ran dry: grow by one rather than fail the shot
+	if (!P) P = SpawnPooled(RowName, Cls);
+	if (P && InOwner) P->SetOwner(InOwner);
+	return P;
+}
+
+void UWS_FireModeRegistry::HandleProjectileDeactivated(ACPP_ProjectileParent* Projectile)
+{
+	if (!IsValid(Projectile)) return;
+
+	const FName* Mode = PooledMode.Find(Projectile);
+	if (!Mode) return;
+
+	FFireModeProjectilePool& Pool = Pools.FindOrAdd(*Mode);
+	Pool.Free.AddUnique(Projectile);
+}
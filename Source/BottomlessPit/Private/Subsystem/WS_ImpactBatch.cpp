@@ -0,0 +1,260 @@
+﻿// WS_ImpactBatch.cpp
+
+
+#include "Subsystem/WS_ImpactBatch.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Materials/MaterialInterface.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "PaperFlipbook.h"
+#include "PaperSprite.h"
+#include "SpriteDrawCall.h"
+#include "Subsystem/WS_VFXRowCache.h"
+
+UWS_ImpactBatch* UWS_ImpactBatch::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_ImpactBatch>() : nullptr;
+}
+
+bool UWS_ImpactBatch::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_ImpactBatch::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_ImpactBatch, STATGROUP_Tickables);
+}
+
+void UWS_ImpactBatch::Deinitialize()
+{
+	Types.Empty();
+	TypeComponents.Empty();
+	TypeMaterials.Empty();
+	TypeFrameLUTs.Empty();
+	HostActor = nullptr;
+	Super::Deinitialize();
+}
+
+void UWS_ImpactBatch::Configure(UStaticMesh* QuadMesh, UMaterialInterface* SheetMaterial)
+{
+	if (!QuadMesh || !SheetMaterial)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ImpactBatch] Configure: missing mesh or material"));
+		return;
+	}
+
+	Quad = QuadMesh;
+	BaseMaterial = SheetMaterial;
+
+	const FVector Ext = QuadMesh->GetBounds().BoxExtent;
+	QuadSizeUU = FVector2D(FMath::Max(Ext.X * 2.f, 1e-3f), FMath::Max(Ext.Z * 2.f, 1e-3f));
+}
+
+bool UWS_ImpactBatch::BakedUVBounds(const UPaperSprite* Sprite, FBox2D& OutUV)
+{
+	// baked triangles exist in cooked builds (source UV/size are editor-only); ZW is the normalized atlas UV
+	OutUV.Init();
+	if (!Sprite) return false;
+
+	FSpriteDrawCallRecord Record;
+	Record.BuildFromSprite(Sprite);
+	for (const FVector4& V : Record.RenderVerts)
+	{
+		OutUV += FVector2D(V.Z, V.W);
+	}
+	const FVector2D Size = OutUV.GetSize();
+	return OutUV.bIsValid && Size.X > KINDA_SMALL_NUMBER && Size.Y > KINDA_SMALL_NUMBER;
+}
+
+UTexture2D* UWS_ImpactBatch::BuildFrameLUT(const UPaperFlipbook* Flipbook, int32 Columns, int32 Rows, int32& OutFrames)
+{
+	// one texel per displayed frame, holding the atlas cell of that frame's sprite
+	TArray<float> Cells;
+	Cells.Reserve(Flipbook->GetNumFrames());
+	for (int32 k = 0; k < Flipbook->GetNumKeyFrames(); ++k)
+	{
+		const FPaperFlipbookKeyFrame& Key = Flipbook->GetKeyFrameChecked(k);
+		int32 Cell = k;
+		FBox2D UV;
+		if (BakedUVBounds(Key.Sprite, UV))
+		{
+			const FVector2D Center = UV.GetCenter();
+			const int32 Col = FMath::Clamp(FMath::FloorToInt(Center.X * Columns), 0, Columns - 1);
+			const int32 Row = FMath::Clamp(FMath::FloorToInt(Center.Y * Rows), 0, Rows - 1);
+			Cell = Row * Columns + Col;
+		}
+		for (int32 r = 0; r < FMath::Max(Key.FrameRun, 1); ++r) Cells.Add(float(Cell));
+	}
+
+	OutFrames = Cells.Num();
+	if (OutFrames == 0) return nullptr;
+
+	UTexture2D* LUT = UTexture2D::CreateTransient(OutFrames, 1, PF_R32_FLOAT);
+	if (!LUT) return nullptr;
+
+	LUT->Filter = TF_Nearest;
+	LUT->SRGB = false;
+	LUT->AddressX = TA_Clamp;
+	LUT->AddressY = TA_Clamp;
+
+	FTexture2DMipMap& Mip = LUT->GetPlatformData()->Mips[0];
+	FMemory::Memcpy(Mip.BulkData.Lock(LOCK_READ_WRITE), Cells.GetData(), Cells.Num() * sizeof(float));
+	Mip.BulkData.Unlock();
+	LUT->UpdateResource();
+	return LUT;
+}
+
+bool UWS_ImpactBatch::RegisterType(FName TypeName, UPaperFlipbook* Flipbook, int32 Columns, int32 Capacity, FLinearColor Tint)
+{
+	UWorld* World = GetWorld();
+	if (!World || !Quad || !BaseMaterial || !Flipbook || TypeName.IsNone()) return false;
+	if (Types.Contains(TypeName)) return true;
+
+	const int32 Frames = Flipbook->GetNumFrames();
+	const UPaperSprite* First = Flipbook->GetSpriteAtFrame(0);
+	if (Frames <= 0 || !First)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ImpactBatch] %s: flipbook has no frames"), *TypeName.ToString());
+		return false;
+	}
+
+	if (!HostActor)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+		if (!HostActor) return false;
+	}
+
+	// Sheet layout from the first sprite's baked UV rect; timing per displayed frame through the LUT
+	UTexture2D* Atlas = First->GetBakedTexture();
+	FBox2D FirstUV;
+	const bool bHasUV = BakedUVBounds(First, FirstUV);
+	const int32 Cols = Columns > 0 ? Columns
+		: (bHasUV ? FMath::Max(1, FMath::RoundToInt(1.f / FirstUV.GetSize().X)) : 1);
+	const int32 Rows = bHasUV
+		? FMath::Max(1, FMath::RoundToInt(1.f / FirstUV.GetSize().Y))
+		: FMath::DivideAndRoundUp(Flipbook->GetNumKeyFrames(), Cols);
+
+	int32 DisplayFrames = 0;
+	UTexture2D* FrameLUT = BuildFrameLUT(Flipbook, Cols, Rows, DisplayFrames);
+	if (!FrameLUT)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ImpactBatch] %s: could not build frame LUT"), *TypeName.ToString());
+		return false;
+	}
+
+	UMaterialInstanceDynamic* MID = UMaterialInstanceDynamic::Create(BaseMaterial, this);
+	if (Atlas) MID->SetTextureParameterValue(TEXT("Atlas"), Atlas);
+	MID->SetTextureParameterValue(TEXT("FrameLUT"), FrameLUT);
+	MID->SetScalarParameterValue(TEXT("Columns"), float(Cols));
+	MID->SetScalarParameterValue(TEXT("Rows"), float(Rows));
+	MID->SetScalarParameterValue(TEXT("FrameCount"), float(DisplayFrames));
+	MID->SetScalarParameterValue(TEXT("FPS"), FMath::Max(Flipbook->GetFramesPerSecond(), KINDA_SMALL_NUMBER));
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(HostActor);
+	if (!HostActor->GetRootComponent()) HostActor->SetRootComponent(ISM);
+	else ISM->SetupAttachment(HostActor->GetRootComponent());
+	ISM->SetStaticMesh(Quad);
+	ISM->SetMaterial(0, MID);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetGenerateOverlapEvents(false);
+	ISM->SetCastShadow(false);
+	ISM->SetCanEverAffectNavigation(false);
+	ISM->SetNumCustomDataFloats(NumCustomData);
+	ISM->RegisterComponent();
+
+	// Ring of dead instances (zero scale, spawn time far in the past)
+	const int32 N = FMath::Clamp(Capacity, 1, 8192);
+	TArray<FTransform> Hidden;
+	Hidden.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), N);
+	ISM->AddInstances(Hidden, /*bShouldReturnIndices*/ false, /*bWorldSpace*/ true);
+
+	const float Dead[NumCustomData] = { -1000.f, 0.f, 0.f, 0.f, 0.f };
+	for (int32 i = 0; i < N; ++i)
+	{
+		ISM->SetCustomData(i, MakeArrayView(Dead, NumCustomData), /*bMarkRenderStateDirty*/ false);
+	}
+
+	FImpactType& T = Types.Add(TypeName);
+	T.Instances = ISM;
+	const FVector RB = Flipbook->GetRenderBounds().BoxExtent;
+	T.SizeUU = FVector2D(FMath::Max(RB.X * 2.f, 1.f), FMath::Max(RB.Z * 2.f, 1.f));
+	T.Tint = Tint;
+	T.bDirty = true;
+	bAnyDirty = true;
+
+	TypeComponents.Add(ISM);
+	TypeMaterials.Add(MID);
+	TypeFrameLUTs.Add(FrameLUT);
+	return true;
+}
+
+void UWS_ImpactBatch::RegisterRowsFromTable(UDataTable* VFXTable, const TArray<FName>& RowNames, int32 Columns, int32 Capacity)
+{
+	UWS_VFXRowCache* Cache = UWS_VFXRowCache::Get(this);
+	if (!Cache || !VFXTable) return;
+
+	for (const FName& RowName : RowNames)
+	{
+		Cache->Request(VFXTable, RowName,
+			FOnVFXRowResolved::CreateUObject(this, &UWS_ImpactBatch::OnRowResolved, RowName, Columns, Capacity));
+	}
+}
+
+void UWS_ImpactBatch::OnRowResolved(const FVFXAnimationResolved* Resolved, FName RowName, int32 Columns, int32 Capacity)
+{
+	if (!Resolved) return;
+
+	// same pick as ACPP_FVX::PlayResolvedInternal
+	UPaperFlipbook* Anim = Resolved->AnimVar1 ? Resolved->AnimVar1 : Resolved->AnimVar2;
+	RegisterType(RowName, Anim, Columns, Capacity, Resolved->Tint);
+}
+
+bool UWS_ImpactBatch::Spawn(FName TypeName, const FTransform& WorldTransform, FLinearColor Tint)
+{
+	FImpactType* T = Types.Find(TypeName);
+	if (!T || !T->Instances) return false;
+
+	const int32 Count = T->Instances->GetInstanceCount();
+	if (Count == 0) return false;
+
+	const FVector S = WorldTransform.GetScale3D();
+	const FVector Scale(
+		S.X * T->SizeUU.X / QuadSizeUU.X,
+		S.Y,
+		S.Z * T->SizeUU.Y / QuadSizeUU.Y);
+	const FTransform Xf(WorldTransform.GetRotation(), WorldTransform.GetLocation(), Scale);
+
+	const FLinearColor C = T->Tint * Tint;
+	const float Data[NumCustomData] = { GetWorld()->GetTimeSeconds(), C.R, C.G, C.B, C.A };
+
+	// oldest slot is overwritten; a full ring means the oldest impact was about to end anyway
+	const int32 Slot = T->NextSlot;
+	T->NextSlot = (T->NextSlot + 1) % Count;
+
+	T->Instances->UpdateInstanceTransform(Slot, Xf, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ false, /*bTeleport*/ true);
+	T->Instances->SetCustomData(Slot, MakeArrayView(Data, NumCustomData), /*bMarkRenderStateDirty*/ false);
+
+	T->bDirty = true;
+	bAnyDirty = true;
+	return true;
+}
+
+void UWS_ImpactBatch::Tick(float DeltaTime)
+{
+	if (!bAnyDirty) return;
+
+	for (TPair<FName, FImpactType>& It : Types)
+	{
+		if (!It.Value.bDirty || !It.Value.Instances) continue;
+		It.Value.Instances->MarkRenderStateDirty();
+		It.Value.bDirty = false;
+	}
+	bAnyDirty = false;
+}
@@ -0,0 +1,320 @@
+﻿// WS_InputLatencyTracer.cpp
+
+
+#include "Subsystem/WS_InputLatencyTracer.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static FAutoConsoleCommandWithWorldAndArgs GInputLatencyCmd(
+	TEXT("bp.InputLatency"),
+	TEXT("Trace input -> velocity/position/camera latency. Args: [1|0] (no arg toggles)"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(World))
+			{
+				Tracer->SetEnabled(Args.Num() > 0 ? FCString::Atoi(*Args[0]) != 0 : !Tracer->IsEnabled());
+			}
+		}));
+
+static FAutoConsoleCommandWithWorldAndArgs GInputLatencyDumpCmd(
+	TEXT("bp.InputLatencyDump"),
+	TEXT("Log and write the input latency histograms as CSV. Args: [File]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UWS_InputLatencyTracer* Tracer = UWS_InputLatencyTracer::Get(World))
+			{
+				Tracer->LogStats();
+				Tracer->ExportCSV(Args.Num() > 0 ? Args[0] : FString());
+			}
+		}));
+
+static const TCHAR* KindName(int32 Kind)
+{
+	static const TCHAR* Names[] = { TEXT("Move"), TEXT("Jump"), TEXT("Down") };
+	return Names[Kind];
+}
+
+static const TCHAR* ChannelName(int32 Channel)
+{
+	static const TCHAR* Names[] = { TEXT("Velocity"), TEXT("Position"), TEXT("Camera") };
+	return Names[Channel];
+}
+
+UWS_InputLatencyTracer* UWS_InputLatencyTracer::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_InputLatencyTracer>() : nullptr;
+}
+
+bool UWS_InputLatencyTracer::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_InputLatencyTracer::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_InputLatencyTracer, STATGROUP_Tickables);
+}
+
+void UWS_InputLatencyTracer::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ResetHistograms();
+	if (FParse::Param(FCommandLine::Get(), TEXT("InputLatency"))) SetEnabled(true);
+}
+
+void UWS_InputLatencyTracer::Deinitialize()
+{
+	// scripted runs end by tearing the world down: keep what was measured
+	if (bEnabled && HasSamples())
+	{
+		LogStats();
+		ExportCSV();
+	}
+
+	Events.Empty();
+	NumHistory = 0;
+	TracedPC.Reset();
+	bEnabled = false;
+	Super::Deinitialize();
+}
+
+void UWS_InputLatencyTracer::SetEnabled(bool bInEnabled)
+{
+	bEnabled = bInEnabled;
+	Events.Reset();
+	NumHistory = 0;
+	Stats.Pending = 0;
+	UE_LOG(LogTemp, Log, TEXT("[InputLatency] %s"), bEnabled ? TEXT("on") : TEXT("off"));
+}
+
+void UWS_InputLatencyTracer::ResetHistograms()
+{
+	for (int32 k = 0; k < NumKinds; ++k)
+	{
+		for (int32 c = 0; c < NumChannels; ++c)
+		{
+			Histogram[k][c].Init(0, MaxFrames + 2);
+			SumMs[k][c] = 0.0;
+			NumHits[k][c] = 0;
+		}
+	}
+	Stats = FInputLatencyStats();
+}
+
+bool UWS_InputLatencyTracer::HasSamples() const
+{
+	return Stats.Stamped > 0;
+}
+
+bool UWS_InputLatencyTracer::Sample(FSample& Out) const
+{
+	const APlayerController* PC = TracedPC.Get();
+	const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+	if (!Pawn) return false;
+
+	Out.Time = GetWorld()->GetTimeSeconds();
+	Out.Value[(int32)EInputLatencyChannel::Velocity] = Pawn->GetVelocity();
+	Out.Value[(int32)EInputLatencyChannel::Position] = Pawn->GetActorLocation();
+	Out.Value[(int32)EInputLatencyChannel::Camera] = PC->PlayerCameraManager
+		? PC->PlayerCameraManager->GetCameraLocation()
+		: Pawn->GetActorLocation();
+	return true;
+}
+
+void UWS_InputLatencyTracer::Stamp(EInputLatencyKind Kind, APlayerController* PC)
+{
+	if (!bEnabled || !PC) return;
+
+	if (TracedPC.Get() != PC)
+	{
+		// history belongs to one controller; the first stamped event only primes it
+		TracedPC = PC;
+		NumHistory = 0;
+	}
+	if (NumHistory == 0) return;
+
+	if (Events.Num() >= MaxPending)
+	{
+		Events.RemoveAt(0, 1, EAllowShrinking::No);
+		++Stats.Dropped;
+	}
+
+	// pre-input path from the last samples (input is processed before this frame's movement)
+	FEvent E;
+	E.Kind = Kind;
+	E.Frame = GFrameCounter;
+	E.RealTime = FPlatformTime::Seconds();
+	E.BaseTime = History[0].Time;
+
+	for (int32 c = 0; c < NumChannels; ++c)
+	{
+		E.Base[c] = History[0].Value[c];
+		E.Rate[c] = FVector::ZeroVector;
+		E.Accel[c] = FVector::ZeroVector;
+
+		const double Dt01 = NumHistory > 1 ? History[0].Time - History[1].Time : 0.0;
+		if (Dt01 <= UE_KINDA_SMALL_NUMBER) continue;
+		E.Rate[c] = (History[0].Value[c] - History[1].Value[c]) / Dt01;
+
+		const double Dt12 = NumHistory > 2 ? History[1].Time - History[2].Time : 0.0;
+		if (Dt12 <= UE_KINDA_SMALL_NUMBER) continue;
+		const FVector PrevRate = (History[1].Value[c] - History[2].Value[c]) / Dt12;
+		E.Accel[c] = (E.Rate[c] - PrevRate) / (0.5 * (Dt01 + Dt12));
+	}
+
+	Events.Add(E);
+	++Stats.Stamped;
+	Stats.Pending = Events.Num();
+}
+
+void UWS_InputLatencyTracer::Record(const FEvent& E, int32 Channel, int32 Frames, double Ms)
+{
+	const int32 k = (int32)E.Kind;
+	TArray<int32>& H = Histogram[k][Channel];
+	if (Frames < 0)
+	{
+		++H.Last();
+		return;
+	}
+
+	++H[FMath::Min(Frames, MaxFrames)];
+	SumMs[k][Channel] += Ms;
+	++NumHits[k][Channel];
+}
+
+void UWS_InputLatencyTracer::Tick(float DeltaTime)
+{
+	if (!bEnabled) return;
+
+	if (!TracedPC.IsValid())
+	{
+		TracedPC = GetWorld()->GetFirstPlayerController();
+		NumHistory = 0;
+	}
+
+	FSample Now;
+	if (!Sample(Now))
+	{
+		NumHistory = 0;
+		return;
+	}
+
+	const uint64 Frame = GFrameCounter;
+	const double RealNow = FPlatformTime::Seconds();
+	const float Thresholds[NumChannels] = { VelocityThreshold, PositionThreshold, CameraThreshold };
+	const uint8 AllDone = (1 << NumChannels) - 1;
+
+	for (int32 i = Events.Num() - 1; i >= 0; --i)
+	{
+		FEvent& E = Events[i];
+		const int32 Frames = (int32)(Frame - E.Frame);
+		const double t = Now.Time - E.BaseTime;
+		const int32 Axis = E.Kind == EInputLatencyKind::Move ? 0 : 2;
+
+		for (int32 c = 0; c < NumChannels; ++c)
+		{
+			if (E.DoneMask & (1 << c)) continue;
+
+			// velocity is one derivative down: extrapolate it linearly, positions ballistically
+			const FVector Predicted = c == (int32)EInputLatencyChannel::Velocity
+				? E.Base[c] + E.Rate[c] * t
+				: E.Base[c] + E.Rate[c] * t + E.Accel[c] * (0.5 * t * t);
+
+			if (FMath::Abs(Now.Value[c][Axis] - Predicted[Axis]) > Thresholds[c])
+			{
+				Record(E, c, Frames, (RealNow - E.RealTime) * 1000.0);
+				E.DoneMask |= (1 << c);
+			}
+		}
+
+		if (E.DoneMask == AllDone) { Events.RemoveAtSwap(i, 1, EAllowShrinking::No); continue; }
+		if (Frames < MaxFrames) continue;
+
+		for (int32 c = 0; c < NumChannels; ++c)
+		{
+			if (!(E.DoneMask & (1 << c))) Record(E, c, -1, 0.0);
+		}
+		if (E.DoneMask == 0) ++Stats.NoResponse;
+		Events.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+	Stats.Pending = Events.Num();
+
+	History[2] = History[1];
+	History[1] = History[0];
+	History[0] = Now;
+	NumHistory = FMath::Min(NumHistory + 1, 3);
+}
+
+bool UWS_InputLatencyTracer::ExportCSV(const FString& FileName)
+{
+	FString Path = FileName;
+	if (Path.IsEmpty())
+	{
+		Path = FPaths::ProjectSavedDir() / TEXT("Profiling") /
+			FString::Printf(TEXT("InputLatency_%s.csv"), *FDateTime::Now().ToString());
+	}
+	else if (FPaths::IsRelative(Path))
+	{
+		Path = FPaths::ProjectSavedDir() / TEXT("Profiling") / Path;
+	}
+
+	FString Csv = TEXT("Kind,Channel,Frames,Count\n");
+	for (int32 k = 0; k < NumKinds; ++k)
+	{
+		for (int32 c = 0; c < NumChannels; ++c)
+		{
+			const TArray<int32>& H = Histogram[k][c];
+			for (int32 f = 0; f < H.Num(); ++f)
+			{
+				if (H[f] == 0) continue;
+				const FString Bucket = f == H.Num() - 1 ? FString(TEXT("never")) : FString::FromInt(f);
+				Csv += FString::Printf(TEXT("%s,%s,%s,%d\n"), KindName(k), ChannelName(c), *Bucket, H[f]);
+			}
+		}
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *Path))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[InputLatency] could not write %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[InputLatency] wrote %s"), *Path);
+	return true;
+}
+
+void UWS_InputLatencyTracer::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("[InputLatency] stamped=%d pending=%d dropped=%d noResponse=%d"),
+		Stats.Stamped, Stats.Pending, Stats.Dropped, Stats.NoResponse);
+
+	for (int32 k = 0; k < NumKinds; ++k)
+	{
+		for (int32 c = 0; c < NumChannels; ++c)
+		{
+			const int32 N = NumHits[k][c];
+			if (N == 0) continue;
+
+			// p50/p95 in frames from the histogram (the "never" bucket is not counted)
+			const TArray<int32>& H = Histogram[k][c];
+			int32 P50 = -1, P95 = -1, Acc = 0;
+			for (int32 f = 0; f < H.Num() - 1; ++f)
+			{
+				Acc += H[f];
+				if (P50 < 0 && Acc * 2 >= N) P50 = f;
+				if (P95 < 0 && Acc * 20 >= N * 19) P95 = f;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("[InputLatency] %s -> %s: n=%d p50=%d p95=%d frames, mean=%.1f ms, never=%d"),
+				KindName(k), ChannelName(c), N, P50, P95, SumMs[k][c] / N, H.Last());
+		}
+	}
+}
@@ -0,0 +1,153 @@
+﻿// WS_Perception2D.cpp
+
+
+#include "Subsystem/WS_Perception2D.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+
+UWS_Perception2D* UWS_Perception2D::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_Perception2D>() : nullptr;
+}
+
+bool UWS_Perception2D::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_Perception2D::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_Perception2D, STATGROUP_Tickables);
+}
+
+void UWS_Perception2D::Deinitialize()
+{
+	Entries.Empty();
+	Player.Reset();
+	Super::Deinitialize();
+}
+
+float UWS_Perception2D::Dist2D(const FVector& A, const FVector& B)
+{
+	FVector D = B - A; D.Y = 0.f;   // XZ plane
+	return D.Size();
+}
+
+void UWS_Perception2D::Tick(float DeltaTime)
+{
+	RefreshPlayer();
+	HarvestResults();
+	SendBatch();
+}
+
+void UWS_Perception2D::RefreshPlayer()
+{
+	if (!Player.IsValid()) Player = UGameplayStatics::GetPlayerPawn(this, 0);
+
+	if (const APawn* P = Player.Get())
+	{
+		PlayerLocation = P->GetActorLocation();
+		PlayerVelocity = P->GetVelocity();
+	}
+}
+
+bool UWS_Perception2D::QueryPlayerLOS(const AActor* Observer, float EyeHeight, float Range, ECollisionChannel Channel,
+	bool& bOutHasLOS, float& OutDist)
+{
+	bOutHasLOS = false;
+	OutDist = 0.f;
+	if (!Observer || !Player.IsValid()) return false;
+
+	OutDist = Dist2D(Observer->GetActorLocation(), PlayerLocation);
+
+	FLOSKey Key;
+	Key.Observer = TObjectKey<AActor>(Observer);
+	Key.EyeHeight = FMath::RoundToInt(EyeHeight);
+	Key.Channel = Channel;
+
+	FLOSEntry& E = Entries.FindOrAdd(Key);
+	E.Observer = Observer;
+	E.EyeHeight = EyeHeight;
+	E.Channel = Channel;
+	// several callers may share this entry between sends; trace far enough for all of them
+	E.Range = E.bAsked ? FMath::Max(E.Range, Range) : Range;
+	E.LastAskTime = GetWorld()->GetTimeSeconds();
+	E.bAsked = true;
+
+	// out of range needs no trace; the old result is stale once we come back
+	if (OutDist > Range)
+	{
+		if (OutDist > E.Range) E.bHasResult = false;   // a wider-range sharer may still own the result
+		return true;
+	}
+
+	bOutHasLOS = E.bHasLOS;
+	return E.bHasResult;
+}
+
+void UWS_Perception2D::HarvestResults()
+{
+	UWorld* W = GetWorld();
+	const APawn* P = Player.Get();
+
+	for (TPair<FLOSKey, FLOSEntry>& It : Entries)
+	{
+		FLOSEntry& E = It.Value;
+		if (!E.Pending.IsValid()) continue;
+
+		FTraceDatum Datum;
+		if (!W->QueryTraceData(E.Pending, Datum))
+		{
+			// async results only live for a frame or two; a missed one is re-sent
+			if (GFrameCounter - E.SentFrame > 2) { E.Pending = FTraceHandle(); E.bAsked = true; }
+			continue;
+		}
+		E.Pending = FTraceHandle();
+
+		// a clear line, or the first thing hit is the player
+		const FHitResult* Hit = Datum.OutHits.FindByPredicate([](const FHitResult& H) { return H.bBlockingHit; });
+		E.bHasLOS = !Hit || (P && Hit->GetActor() == P);
+		E.bHasResult = true;
+	}
+}
+
+void UWS_Perception2D::SendBatch()
+{
+	LastBatchSize = 0;
+
+	UWorld* W = GetWorld();
+	const float Now = W->GetTimeSeconds();
+	const APawn* P = Player.Get();
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FLOSEntry& E = It.Value();
+		const AActor* Me = E.Observer.Get();
+
+		if (!Me || Now - E.LastAskTime > ForgetAfterSeconds)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (!P || !E.bAsked || E.Pending.IsValid()) continue;
+
+		const FVector M = Me->GetActorLocation();
+		FVector Dir = PlayerLocation - M; Dir.Y = 0.f;
+		const float Dist = Dir.Size();
+		if (Dist > E.Range) continue;   // answered by the range test on ask
+
+		E.bAsked = false;
+		if (Dist <= KINDA_SMALL_NUMBER) { E.bHasLOS = true; E.bHasResult = true; continue; }
+
+		const FVector Start(M.X, M.Y, M.Z + E.EyeHeight);
+		const FVector End = Start + Dir / Dist * (Dist + 1.f);
+
+		FCollisionQueryParams Q(SCENE_QUERY_STAT(Perception2D_LOS), false, Me);
+		E.Pending = W->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, E.Channel, Q);
+		E.SentFrame = GFrameCounter;
+		++LastBatchSize;
+	}
+}
@@ -0,0 +1,285 @@
+﻿// WS_PlatformGraph2D.cpp
+
+
+#include "Subsystem/WS_PlatformGraph2D.h"
+#include "Engine/World.h"
+#include "Actor/LevelActor/PlatformStrip.h"
+
+UWS_PlatformGraph2D* UWS_PlatformGraph2D::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_PlatformGraph2D>() : nullptr;
+}
+
+bool UWS_PlatformGraph2D::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWS_PlatformGraph2D::Deinitialize()
+{
+	for (const TPair<TObjectKey<APlatformStrip>, TArray<int32>>& It : StripNodes)
+	{
+		if (APlatformStrip* S = It.Key.ResolveObjectPtr()) S->OnSpansChanged.RemoveAll(this);
+	}
+
+	Nodes.Empty();
+	FreeNodes.Empty();
+	StripNodes.Empty();
+	NumLive = 0;
+	Super::Deinitialize();
+}
+
+// --------------------------- Build ---------------------------
+
+void UWS_PlatformGraph2D::AddStrip(APlatformStrip* Strip)
+{
+	if (!IsValid(Strip)) return;
+
+	TArray<int32>* Existing = StripNodes.Find(Strip);
+	if (Existing)
+	{
+		// re-add = refresh (strip moved or re-split)
+		for (int32 N : *Existing) RemoveNode(N);
+		Existing->Reset();
+	}
+	else
+	{
+		Strip->OnSpansChanged.AddUObject(this, &UWS_PlatformGraph2D::HandleStripSpansChanged);
+		Existing = &StripNodes.Add(Strip);
+	}
+
+	TArray<FBox> Boxes;
+	Strip->GetSolidSpansWorld(Boxes);
+
+	TArray<int32>& Mine = *Existing;
+	for (const FBox& B : Boxes) Mine.Add(AddNode(Strip, B));
+
+	// after all spans exist so a strip's own pieces link to each other too
+	for (int32 N : Mine) LinkNode(N);
+}
+
+void UWS_PlatformGraph2D::RemoveStrip(APlatformStrip* Strip)
+{
+	if (!Strip) return;
+
+	TArray<int32> Mine;
+	if (!StripNodes.RemoveAndCopyValue(Strip, Mine)) return;
+
+	Strip->OnSpansChanged.RemoveAll(this);
+	for (int32 N : Mine) RemoveNode(N);
+}
+
+void UWS_PlatformGraph2D::RebaseZ(float DeltaZ)
+{
+	for (FNode& N : Nodes)
+	{
+		if (!N.bLive) continue;
+		N.Span.TopZ += DeltaZ;
+		N.Span.BottomZ += DeltaZ;
+	}
+}
+
+void UWS_PlatformGraph2D::HandleStripSpansChanged(APlatformStrip* Strip)
+{
+	AddStrip(Strip);
+}
+
+int32 UWS_PlatformGraph2D::AddNode(APlatformStrip* Strip, const FBox& Box)
+{
+	const int32 Id = FreeNodes.Num() > 0 ? FreeNodes.Pop(EAllowShrinking::No) : Nodes.AddDefaulted();
+
+	FNode& N = Nodes[Id];
+	N.Span.MinX = Box.Min.X;
+	N.Span.MaxX = Box.Max.X;
+	N.Span.TopZ = Box.Max.Z;
+	N.Span.BottomZ = Box.Min.Z;
+	N.Span.Y = Strip->GetActorLocation().Y;
+	N.Span.Strip = Strip;
+	N.Links.Reset();
+	N.LinkedFrom.Reset();
+	N.bLive = true;
+
+	++NumLive;
+	return Id;
+}
+
+void UWS_PlatformGraph2D::RemoveNode(int32 Id)
+{
+	if (!Nodes.IsValidIndex(Id) || !Nodes[Id].bLive) return;
+
+	FNode& N = Nodes[Id];
+
+	for (const FLink& L : N.Links)
+	{
+		if (Nodes.IsValidIndex(L.To)) Nodes[L.To].LinkedFrom.RemoveSwap(Id, EAllowShrinking::No);
+	}
+	for (int32 From : N.LinkedFrom)
+	{
+		if (Nodes.IsValidIndex(From))
+			Nodes[From].Links.RemoveAllSwap([Id](const FLink& L) { return L.To == Id; }, EAllowShrinking::No);
+	}
+
+	N.Links.Reset();
+	N.LinkedFrom.Reset();
+	N.Span.Strip.Reset();
+	N.bLive = false;
+
+	FreeNodes.Add(Id);
+	--NumLive;
+}
+
+bool UWS_PlatformGraph2D::Classify(const FPlatformSpan2D& From, const FPlatformSpan2D& To, EPlatformLink2D& OutKind) const
+{
+	// horizontal gap between the spans (0 when they overlap in X)
+	const float Gap = FMath::Max(0.f, FMath::Max(From.MinX, To.MinX) - FMath::Min(From.MaxX, To.MaxX));
+	const float Rise = To.TopZ - From.TopZ;
+
+	if (FMath::Abs(Rise) <= Limits.StepToleranceUU)
+	{
+		if (Gap <= Limits.WalkGapUU) { OutKind = EPlatformLink2D::Walk; return true; }
+		if (Gap <= Limits.MaxJumpGapUU) { OutKind = EPlatformLink2D::Jump; return true; }
+		return false;
+	}
+
+	if (Rise > 0.f)
+	{
+		if (Rise > Limits.MaxJumpUpUU || Gap > Limits.MaxJumpGapUU) return false;
+		OutKind = EPlatformLink2D::Jump;
+		return true;
+	}
+
+	if (-Rise > Limits.MaxDropUU || Gap > Limits.MaxDropGapUU) return false;
+
+	// walking off needs an edge of From outside To's X range
+	if (Gap <= 0.f && From.MinX >= To.MinX && From.MaxX <= To.MaxX) return false;
+
+	OutKind = EPlatformLink2D::Drop;
+	return true;
+}
+
+void UWS_PlatformGraph2D::LinkNode(int32 Id)
+{
+	// Live node count is a few rows' worth of spans, so a flat scan beats keeping a Z index in sync
+	const float Band = FMath::Max(Limits.MaxJumpUpUU, Limits.MaxDropUU) + Limits.StepToleranceUU;
+
+	for (int32 Other = 0; Other < Nodes.Num(); ++Other)
+	{
+		if (Other == Id || !Nodes[Other].bLive) continue;
+
+		FNode& A = Nodes[Id];
+		FNode& B = Nodes[Other];
+		if (FMath::Abs(A.Span.TopZ - B.Span.TopZ) > Band) continue;
+
+		// a strip's own pieces may both be new; link each pair once
+		if (A.Links.ContainsByPredicate([Other](const FLink& L) { return L.To == Other; })) continue;
+		if (A.LinkedFrom.Contains(Other)) continue;
+
+		EPlatformLink2D Kind;
+		if (Classify(A.Span, B.Span, Kind))
+		{
+			A.Links.Add({ Other, Kind });
+			B.LinkedFrom.Add(Id);
+		}
+		if (Classify(B.Span, A.Span, Kind))
+		{
+			B.Links.Add({ Id, Kind });
+			A.LinkedFrom.Add(Other);
+		}
+	}
+}
+
+// --------------------------- Queries ---------------------------
+
+int32 UWS_PlatformGraph2D::FindSpanBelow(const FVector& At, float MaxDown) const
+{
+	int32 Best = INDEX_NONE;
+	float BestZ = -FLT_MAX;
+
+	for (int32 i = 0; i < Nodes.Num(); ++i)
+	{
+		const FNode& N = Nodes[i];
+		if (!N.bLive) continue;
+		if (At.X < N.Span.MinX || At.X > N.Span.MaxX) continue;
+		if (N.Span.TopZ > At.Z || N.Span.TopZ < At.Z - MaxDown) continue;
+		if (N.Span.TopZ > BestZ) { BestZ = N.Span.TopZ; Best = i; }
+	}
+	return Best;
+}
+
+bool UWS_PlatformGraph2D::GroundBelow(const FVector& At, float MaxDown, FVector& OutGround) const
+{
+	const int32 Id = FindSpanBelow(At, MaxDown);
+	if (Id == INDEX_NONE) return false;
+
+	OutGround = FVector(At.X, At.Y, Nodes[Id].Span.TopZ);
+	return true;
+}
+
+bool UWS_PlatformGraph2D::GetSpan(int32 Id, FPlatformSpan2D& OutSpan) const
+{
+	if (!Nodes.IsValidIndex(Id) || !Nodes[Id].bLive) return false;
+	OutSpan = Nodes[Id].Span;
+	return true;
+}
+
+void UWS_PlatformGraph2D::GetWalkConnected(int32 Id, TArray<int32>& OutNodes) const
+{
+	OutNodes.Reset();
+	if (!Nodes.IsValidIndex(Id) || !Nodes[Id].bLive) return;
+
+	OutNodes.Add(Id);
+	for (int32 i = 0; i < OutNodes.Num(); ++i)
+	{
+		for (const FLink& L : Nodes[OutNodes[i]].Links)
+		{
+			if (L.Kind == EPlatformLink2D::Walk) OutNodes.AddUnique(L.To);
+		}
+	}
+}
+
+bool UWS_PlatformGraph2D::IsHeadroomClear(float X, float HalfWidth, float FromZ, float Height) const
+{
+	const float ToZ = FromZ + Height;
+
+	for (const FNode& N : Nodes)
+	{
+		if (!N.bLive) continue;
+		if (X + HalfWidth < N.Span.MinX || X - HalfWidth > N.Span.MaxX) continue;
+		if (N.Span.BottomZ < ToZ && N.Span.TopZ > FromZ) return false;
+	}
+	return true;
+}
+
+int32 UWS_PlatformGraph2D::FindJumpUp(int32 Id, float PreferX, float MaxRise, float& OutTakeoffX) const
+{
+	if (!Nodes.IsValidIndex(Id) || !Nodes[Id].bLive) return INDEX_NONE;
+
+	const FPlatformSpan2D& From = Nodes[Id].Span;
+	int32 Best = INDEX_NONE;
+	float BestDist = FLT_MAX;
+
+	for (const FLink& L : Nodes[Id].Links)
+	{
+		if (L.Kind != EPlatformLink2D::Jump) continue;
+
+		const FPlatformSpan2D& To = Nodes[L.To].Span;
+		const float Rise = To.TopZ - From.TopZ;
+		if (Rise <= Limits.StepToleranceUU || Rise > MaxRise) continue;
+
+		// enemy jumps are vertical: take off where both spans overlap in X
+		const float Lo = FMath::Max(From.MinX, To.MinX);
+		const float Hi = FMath::Min(From.MaxX, To.MaxX);
+		if (Lo > Hi) continue;
+
+		const float TakeoffX = FMath::Clamp(PreferX, Lo, Hi);
+		const float Dist = FMath::Abs(TakeoffX - PreferX);
+		if (Dist < BestDist)
+		{
+			BestDist = Dist;
+			Best = L.To;
+			OutTakeoffX = TakeoffX;
+		}
+	}
+	return Best;
+}
@@ -0,0 +1,287 @@
+﻿// WS_SpatialHash2D.cpp
+
+
+#include "Subsystem/WS_SpatialHash2D.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+
+UWS_SpatialHash2D* UWS_SpatialHash2D::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_SpatialHash2D>() : nullptr;
+}
+
+bool UWS_SpatialHash2D::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWS_SpatialHash2D::Deinitialize()
+{
+	Entries.Empty();
+	FreeEntries.Empty();
+	Lookup.Empty();
+	Cells.Empty();
+	Super::Deinitialize();
+}
+
+// --------------------------- Registration ---------------------------
+
+void UWS_SpatialHash2D::Register(AActor* Actor, ESpatialKind2D Kind)
+{
+	if (!IsValid(Actor)) return;
+
+	const FVector L = Actor->GetActorLocation();
+	FVector2D Half(1.f, 1.f);
+	FVector2D Offset = FVector2D::ZeroVector;
+
+	// root primitive bounds (capsule / sphere); fall back to a point
+	if (const UPrimitiveComponent* Prim = Cast<UPrimitiveComponent>(Actor->GetRootComponent()))
+	{
+		const FBoxSphereBounds& B = Prim->Bounds;
+		Half = FVector2D(B.BoxExtent.X, B.BoxExtent.Z);
+		Offset = FVector2D(B.Origin.X - L.X, B.Origin.Z - L.Z);
+	}
+
+	Insert(Actor, Kind, FVector2D(L.X, L.Z) + Offset, Half, Offset);
+}
+
+void UWS_SpatialHash2D::RegisterBox(AActor* Actor, ESpatialKind2D Kind, const FBox& WorldBox)
+{
+	if (!IsValid(Actor) || !WorldBox.IsValid) return;
+
+	const FVector L = Actor->GetActorLocation();
+	const FVector C = WorldBox.GetCenter();
+	const FVector E = WorldBox.GetExtent();
+
+	Insert(Actor, Kind, FVector2D(C.X, C.Z), FVector2D(E.X, E.Z), FVector2D(C.X - L.X, C.Z - L.Z));
+}
+
+void UWS_SpatialHash2D::Insert(AActor* Actor, ESpatialKind2D Kind, const FVector2D& Center, const FVector2D& Half, const FVector2D& Offset)
+{
+	int32 Index = INDEX_NONE;
+	if (const int32* Found = Lookup.Find(Actor))
+	{
+		// re-register: drop the old cells, keep the slot
+		Index = *Found;
+		UnlinkCells(Index);
+	}
+	else
+	{
+		Index = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+		Lookup.Add(Actor, Index);
+	}
+
+	FEntry& E = Entries[Index];
+	E.Actor = Actor;
+	E.Kind = Kind;
+	E.Center = Center;
+	E.Half = FVector2D(FMath::Max(Half.X, 0.0), FMath::Max(Half.Y, 0.0));
+	E.Offset = Offset;
+	E.bLive = true;
+
+	LinkCells(Index);
+}
+
+void UWS_SpatialHash2D::Unregister(AActor* Actor)
+{
+	if (!Actor) return;
+
+	int32 Index = INDEX_NONE;
+	if (!Lookup.RemoveAndCopyValue(Actor, Index)) return;
+
+	UnlinkCells(Index);
+	Entries[Index] = FEntry();
+	FreeEntries.Add(Index);
+}
+
+void UWS_SpatialHash2D::UpdateActor(const AActor* Actor)
+{
+	if (!Actor) return;
+	const int32* Found = Lookup.Find(Actor);
+	if (!Found) return;
+
+	FEntry& E = Entries[*Found];
+	const FVector L = Actor->GetActorLocation();
+	E.Center = FVector2D(L.X, L.Z) + E.Offset;
+
+	const FIntPoint NewMin = CellOf(E.Center.X - E.Half.X, E.Center.Y - E.Half.Y);
+	const FIntPoint NewMax = CellOf(E.Center.X + E.Half.X, E.Center.Y + E.Half.Y);
+	if (NewMin == E.CellMin && NewMax == E.CellMax) return;
+
+	UnlinkCells(*Found);
+	LinkCells(*Found);
+}
+
+void UWS_SpatialHash2D::RebaseZ(float DeltaZ)
+{
+	if (FMath::IsNearlyZero(DeltaZ)) return;
+
+	// Shift entries and origin together: cell indices stay valid, no rehash.
+	// Anything the loop did not carry is corrected by its next UpdateActor.
+	OriginZ += DeltaZ;
+	for (FEntry& E : Entries)
+	{
+		if (E.bLive) E.Center.Y += DeltaZ;
+	}
+}
+
+// --------------------------- Grid ---------------------------
+
+FIntPoint UWS_SpatialHash2D::CellOf(double X, double Z) const
+{
+	const double Inv = 1.0 / FMath::Max(CellSizeUU, 1.f);
+	return FIntPoint(FMath::FloorToInt32(X * Inv), FMath::FloorToInt32((Z - OriginZ) * Inv));
+}
+
+void UWS_SpatialHash2D::LinkCells(int32 Index)
+{
+	FEntry& E = Entries[Index];
+	E.CellMin = CellOf(E.Center.X - E.Half.X, E.Center.Y - E.Half.Y);
+	E.CellMax = CellOf(E.Center.X + E.Half.X, E.Center.Y + E.Half.Y);
+
+	for (int32 cz = E.CellMin.Y; cz <= E.CellMax.Y; ++cz)
+	{
+		for (int32 cx = E.CellMin.X; cx <= E.CellMax.X; ++cx)
+		{
+			Cells.FindOrAdd(FIntPoint(cx, cz)).Add(Index);
+		}
+	}
+}
+
+void UWS_SpatialHash2D::UnlinkCells(int32 Index)
+{
+	const FEntry& E = Entries[Index];
+	if (!E.bLive) return;
+
+	for (int32 cz = E.CellMin.Y; cz <= E.CellMax.Y; ++cz)
+	{
+		for (int32 cx = E.CellMin.X; cx <= E.CellMax.X; ++cx)
+		{
+			const FIntPoint Key(cx, cz);
+			if (TArray<int32>* Bucket = Cells.Find(Key))
+			{
+				Bucket->RemoveSingleSwap(Index, EAllowShrinking::No);
+				if (Bucket->Num() == 0) Cells.Remove(Key);
+			}
+		}
+	}
+}
+
+uint32 UWS_SpatialHash2D::NextStamp() const
+{
+	if (++QueryCounter == 0)
+	{
+		// wrapped: clear stamps so nothing is skipped by accident
+		for (const FEntry& E : Entries) E.QueryStamp = 0;
+		QueryCounter = 1;
+	}
+	return QueryCounter;
+}
+
+template <typename FuncType>
+void UWS_SpatialHash2D::ForEachCandidate(const FVector2D& Min, const FVector2D& Max, uint8 KindMask, FuncType&& Func) const
+{
+	const uint32 Stamp = NextStamp();
+	const FIntPoint C0 = CellOf(Min.X, Min.Y);
+	const FIntPoint C1 = CellOf(Max.X, Max.Y);
+
+	for (int32 cz = C0.Y; cz <= C1.Y; ++cz)
+	{
+		for (int32 cx = C0.X; cx <= C1.X; ++cx)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(cx, cz));
+			if (!Bucket) continue;
+
+			for (int32 Index : *Bucket)
+			{
+				const FEntry& E = Entries[Index];
+				if (E.QueryStamp == Stamp) continue;   // multi-cell entry already visited
+				E.QueryStamp = Stamp;
+
+				if (!(KindMask & KindBit(E.Kind))) continue;
+				AActor* A = E.Actor.Get();
+				if (!A) continue;
+
+				Func(E, A);
+			}
+		}
+	}
+}
+
+// --------------------------- Queries ---------------------------
+
+int32 UWS_SpatialHash2D::QueryPoint(const FVector& Point, TArray<AActor*>& OutActors, uint8 KindMask) const
+{
+	OutActors.Reset();
+	const FVector2D P(Point.X, Point.Z);
+
+	ForEachCandidate(P, P, KindMask, [&](const FEntry& E, AActor* A)
+		{
+			const FVector2D D = (P - E.Center).GetAbs();
+			if (D.X <= E.Half.X && D.Y <= E.Half.Y) OutActors.Add(A);
+		});
+	return OutActors.Num();
+}
+
+int32 UWS_SpatialHash2D::QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, uint8 KindMask) const
+{
+	OutActors.Reset();
+	const FVector2D P(Center.X, Center.Z);
+	const double R = FMath::Max(Radius, 0.f);
+	const FVector2D RR(R, R);
+
+	ForEachCandidate(P - RR, P + RR, KindMask, [&](const FEntry& E, AActor* A)
+		{
+			// circle vs box: distance from center to the clamped point
+			const FVector2D D = (P - E.Center).GetAbs() - E.Half;
+			const FVector2D Out(FMath::Max(D.X, 0.0), FMath::Max(D.Y, 0.0));
+			if (Out.SizeSquared() <= R * R) OutActors.Add(A);
+		});
+	return OutActors.Num();
+}
+
+int32 UWS_SpatialHash2D::QuerySegment(const FVector& Start, const FVector& End, float Radius, TArray<FSpatialHit2D>& OutHits, uint8 KindMask) const
+{
+	OutHits.Reset();
+	const FVector2D S(Start.X, Start.Z);
+	const FVector2D D(End.X - Start.X, End.Z - Start.Z);
+	const double R = FMath::Max(Radius, 0.f);
+	const FVector2D RR(R, R);
+
+	const FVector2D Min(FMath::Min(S.X, S.X + D.X), FMath::Min(S.Y, S.Y + D.Y));
+	const FVector2D Max(FMath::Max(S.X, S.X + D.X), FMath::Max(S.Y, S.Y + D.Y));
+
+	ForEachCandidate(Min - RR, Max + RR, KindMask, [&](const FEntry& E, AActor* A)
+		{
+			// slab test against the box grown by the radius
+			const FVector2D Lo = E.Center - E.Half - RR;
+			const FVector2D Hi = E.Center + E.Half + RR;
+			double t0 = 0.0, t1 = 1.0;
+			for (int32 Axis = 0; Axis < 2; ++Axis)
+			{
+				const double s = S[Axis], d = D[Axis];
+				if (FMath::Abs(d) < KINDA_SMALL_NUMBER)
+				{
+					if (s < Lo[Axis] || s > Hi[Axis]) return;
+					continue;
+				}
+				double a = (Lo[Axis] - s) / d;
+				double b = (Hi[Axis] - s) / d;
+				if (a > b) Swap(a, b);
+				t0 = FMath::Max(t0, a);
+				t1 = FMath::Min(t1, b);
+				if (t0 > t1) return;
+			}
+
+			FSpatialHit2D& H = OutHits.AddDefaulted_GetRef();
+			H.Actor = A;
+			H.Kind = E.Kind;
+			H.Time = float(t0);
+			H.Location = Start + (End - Start) * t0;
+		});
+
+	OutHits.Sort([](const FSpatialHit2D& L, const FSpatialHit2D& R) { return L.Time < R.Time; });
+	return OutHits.Num();
+}
@@ -0,0 +1,127 @@
+﻿// WS_TrailBatch.cpp
+
+
+#include "Subsystem/WS_TrailBatch.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+UWS_TrailBatch* UWS_TrailBatch::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_TrailBatch>() : nullptr;
+}
+
+bool UWS_TrailBatch::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWS_TrailBatch::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWS_TrailBatch, STATGROUP_Tickables);
+}
+
+void UWS_TrailBatch::Deinitialize()
+{
+	Instances = nullptr;
+	HostActor = nullptr;
+	Super::Deinitialize();
+}
+
+void UWS_TrailBatch::Configure(UStaticMesh* QuadMesh, UMaterialInterface* TrailMaterial, int32 Capacity)
+{
+	UWorld* World = GetWorld();
+	if (!World || !QuadMesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[TrailBatch] Configure: missing world or mesh"));
+		return;
+	}
+
+	if (!HostActor)
+	{
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+		if (!HostActor) return;
+	}
+
+	if (!Instances)
+	{
+		Instances = NewObject<UInstancedStaticMeshComponent>(HostActor, TEXT("TrailInstances"));
+		HostActor->SetRootComponent(Instances);
+		Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Instances->SetGenerateOverlapEvents(false);
+		Instances->SetCastShadow(false);
+		Instances->SetCanEverAffectNavigation(false);
+		Instances->SetTranslucentSortPriority(10);
+		Instances->RegisterComponent();
+	}
+
+	Instances->ClearInstances();
+	Instances->SetStaticMesh(QuadMesh);
+	if (TrailMaterial) Instances->SetMaterial(0, TrailMaterial);
+	Instances->SetNumCustomDataFloats(NumCustomData);
+
+	QuadLengthUU = FMath::Max(QuadMesh->GetBounds().BoxExtent.X * 2.f, 1e-3f);
+
+	// Preallocate the ring: zero scale + ancient spawn time = invisible until written
+	const int32 N = FMath::Clamp(Capacity, 1, 4096);
+	TArray<FTransform> Hidden;
+	Hidden.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), N);
+	Instances->AddInstances(Hidden, /*bShouldReturnIndices*/ false, /*bWorldSpace*/ true);
+
+	const float Dead[NumCustomData] = { 0.f, 0.f, 0.f, 0.f, -1000.f, 0.f, 0.f };
+	for (int32 i = 0; i < N; ++i)
+	{
+		Instances->SetCustomData(i, MakeArrayView(Dead, NumCustomData), /*bMarkRenderStateDirty*/ false);
+	}
+
+	NextSlot = 0;
+	bRenderDirty = true;
+}
+
+bool UWS_TrailBatch::AddTrail(const FVector& From, const FVector& To, float Thickness, float DashFill,
+	float HeadTaper, float Life, float TileWorldUU, bool bUseDashes)
+{
+	if (!Instances || Instances->GetInstanceCount() == 0) return false;
+
+	const FVector2D D2(To.X - From.X, To.Z - From.Z);
+	const float Len2D = D2.Size();
+	if (Len2D <= KINDA_SMALL_NUMBER) return false;
+
+	const FVector Dir = FVector(D2.X, 0.f, D2.Y) / Len2D;
+	const FTransform T(FRotationMatrix::MakeFromX(Dir).ToQuat(), From, FVector(Len2D / QuadLengthUU, 1.f, 1.f));
+
+	const float Data[NumCustomData] =
+	{
+		Len2D / FMath::Max(TileWorldUU, 0.001f),
+		Thickness,
+		DashFill,
+		HeadTaper,
+		GetWorld()->GetTimeSeconds(),
+		FMath::Max(Life, 0.001f),
+		bUseDashes ? 1.f : 0.f
+	};
+
+	// Oldest slot gets overwritten; its tracer has long faded at any sane capacity
+	const int32 Slot = NextSlot;
+	NextSlot = (NextSlot + 1) % Instances->GetInstanceCount();
+
+	Instances->UpdateInstanceTransform(Slot, T, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ false, /*bTeleport*/ true);
+	Instances->SetCustomData(Slot, MakeArrayView(Data, NumCustomData), /*bMarkRenderStateDirty*/ false);
+
+	bRenderDirty = true;
+	return true;
+}
+
+void UWS_TrailBatch::Tick(float DeltaTime)
+{
+	// one flush per frame for all tracers written since the last one
+	if (!bRenderDirty || !Instances) return;
+
+	Instances->MarkRenderStateDirty();
+	bRenderDirty = false;
+}
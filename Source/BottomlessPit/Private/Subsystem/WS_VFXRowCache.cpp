@@ -0,0 +1,140 @@
+﻿// WS_VFXRowCache.cpp
+
+
+#include "Subsystem/WS_VFXRowCache.h"
+#include "Engine/World.h"
+#include "Engine/DataTable.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "PaperFlipbook.h"
+
+UWS_VFXRowCache* UWS_VFXRowCache::Get(const UObject* WorldContextObject)
+{
+	const UWorld* W = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return W ? W->GetSubsystem<UWS_VFXRowCache>() : nullptr;
+}
+
+bool UWS_VFXRowCache::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWS_VFXRowCache::Deinitialize()
+{
+	for (TPair<FRowKey, FEntry>& It : Entries)
+	{
+		if (It.Value.Handle.IsValid()) It.Value.Handle->CancelHandle();
+	}
+	Entries.Empty();
+	HeldAssets.Empty();
+	Super::Deinitialize();
+}
+
+const FVFXAnimationResolved* UWS_VFXRowCache::Find(const UDataTable* Table, FName RowName) const
+{
+	const FEntry* E = Entries.Find(FRowKey(Table, RowName));
+	return (E && E->bReady) ? &E->Resolved : nullptr;
+}
+
+void UWS_VFXRowCache::Request(UDataTable* Table, FName RowName, FOnVFXRowResolved OnDone)
+{
+	if (!IsValid(Table) || RowName.IsNone())
+	{
+		OnDone.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	FEntry* E = Entries.Find(FRowKey(Table, RowName));
+	if (!E) E = StartLoad(Table, RowName);
+	if (!E)
+	{
+		OnDone.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	if (E->bReady)
+	{
+		OnDone.ExecuteIfBound(&E->Resolved);
+		return;
+	}
+
+	// already streaming: join it
+	E->Waiters.Add(MoveTemp(OnDone));
+}
+
+void UWS_VFXRowCache::PreloadTable(UDataTable* Table)
+{
+	if (!IsValid(Table)) return;
+
+	for (const FName& RowName : Table->GetRowNames())
+	{
+		if (!Entries.Contains(FRowKey(Table, RowName))) StartLoad(Table, RowName);
+	}
+}
+
+UWS_VFXRowCache::FEntry* UWS_VFXRowCache::StartLoad(UDataTable* Table, FName RowName)
+{
+	const FVFXAnimationRow* Row = Table->FindRow<FVFXAnimationRow>(RowName, TEXT("VFXRowCache"));
+	if (!Row) return nullptr;
+
+	const FRowKey Key(Table, RowName);
+	Entries.Add(Key);
+
+	TArray<FSoftObjectPath> Paths;
+	for (const TSoftObjectPtr<UPaperFlipbook>* Soft : { &Row->AnimVar1, &Row->AnimVar2, &Row->AnimVar3 })
+	{
+		if (!Soft->IsNull()) Paths.Add(Soft->ToSoftObjectPath());
+	}
+
+	if (Paths.Num() == 0)
+	{
+		OnRowLoaded(Key, *Row);
+		return Entries.Find(Key);
+	}
+
+	// Held after completion so the flipbooks never unload under a playing FVX
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths,
+		FStreamableDelegate::CreateUObject(this, &UWS_VFXRowCache::OnRowLoaded, Key, *Row));
+
+	if (!Handle.IsValid())
+	{
+		Entries.Remove(Key);
+		return nullptr;
+	}
+
+	// the delegate can fire inside RequestAsyncLoad when everything is already resident
+	FEntry* Live = Entries.Find(Key);
+	if (Live) Live->Handle = Handle;
+	return Live;
+}
+
+void UWS_VFXRowCache::OnRowLoaded(FRowKey Key, FVFXAnimationRow Row)
+{
+	FEntry* E = Entries.Find(Key);
+	if (!E) return;
+
+	E->Resolved.AnimVar1 = Row.AnimVar1.Get();
+	E->Resolved.AnimVar2 = Row.AnimVar2.Get();
+	E->Resolved.AnimVar3 = Row.AnimVar3.Get();
+	E->Resolved.Tint = Row.Tint;
+
+	if (!E->Resolved.AnimVar1 && !E->Resolved.AnimVar2 && !E->Resolved.AnimVar3)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[VFXRowCache] %s resolved with no flipbooks"), *Key.Value.ToString());
+	}
+
+	for (UPaperFlipbook* FB : { E->Resolved.AnimVar1, E->Resolved.AnimVar2, E->Resolved.AnimVar3 })
+	{
+		if (FB) HeldAssets.AddUnique(FB);
+	}
+	E->bReady = true;
+
+	// Waiters may request again from inside the callback; iterate a detached list
+	TArray<FOnVFXRowResolved> Waiters = MoveTemp(E->Waiters);
+	const FVFXAnimationResolved Resolved = E->Resolved;
+	for (FOnVFXRowResolved& W : Waiters)
+	{
+		W.ExecuteIfBound(&Resolved);
+	}
+}
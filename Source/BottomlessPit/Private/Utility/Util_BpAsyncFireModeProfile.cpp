@@ -6,6 +6,7 @@
 #include "Engine/StreamableManager.h"
 #include "Engine/DataTable.h"
 #include "PaperSprite.h"
+#include "Subsystem/WS_FireModeRegistry.h"
 
 UUtil_BpAsyncFireModeProfile* UUtil_BpAsyncFireModeProfile::LoadFireModeRowAsync(UObject* WorldContextObject, UDataTable* FireModeTable, FName RowName)
 {
@@ -24,6 +25,18 @@ void UUtil_BpAsyncFireModeProfile::Activate()
 		return;
 	}
 
+	// Preloaded by the registry: no row copy, no stream
+	if (const UWS_FireModeRegistry* Registry = UWS_FireModeRegistry::Get(WorldContext))
+	{
+		FFireModeResolved Cached;
+		if (Registry->GetSourceTable() == Table && Registry->FindFireMode(TargetRow, Cached))
+		{
+			OnCompleted.Broadcast(TargetRow, Cached);
+			SetReadyToDestroy();
+			return;
+		}
+	}
+
 	if (const FFireModeRow* Found = Table->FindRow<FFireModeRow>(TargetRow, TEXT("LoadFireModeRowAsync")))
 	{
 		RowCopy = *Found;
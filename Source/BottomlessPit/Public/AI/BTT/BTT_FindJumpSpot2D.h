@@ -53,13 +53,21 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Ceiling")
 	float TopMargin = 10.f;
 
+	/** Launch limits of the JumpUp2D node that runs next; they cap how high a ledge can be picked */
+	UPROPERTY(EditAnywhere, Category = "Jump")
+	float JumpGravity = 1200.f;
+
+	UPROPERTY(EditAnywhere, Category = "Jump")
+	float MaxJumpSpeed = 1800.f;
+
 protected:
 	virtual EBTNodeResult::Type ExecuteTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 
 private:
-	bool FindCandidate(UWorld* W, const FVector& Origin, const float DirSign, FVector& OutSpot, float NeedHeadroomZ) const;
-	bool GroundAt(UWorld* W, const FVector& From, FVector& OutGround) const;
-	bool HeadroomClear(UWorld* W, const FVector& GroundLoc, float Height) const;
+	bool FindCandidate(UWorld* W, const FVector& Origin, const float DirSign, FVector& OutSpot, float NeedHeadroomZ,
+		float Radius, float HalfHeight) const;
+	bool GroundAt(UWorld* W, const FVector& From, FVector& OutGround, bool& bOutFromGraph) const;
+	bool HeadroomClear(UWorld* W, const FVector& GroundLoc, float Height, float Radius, float HalfHeight, bool bUseGraph) const;
 	
 };
 
@@ -3,15 +3,27 @@
 
 #include "CoreMinimal.h"
 #include "BehaviorTree/BTTaskNode.h"
-#include "Enum/AIMovementState.h"
-#include "Pawn/Enemy/CPP_EnemyParent.h"
+#include "AI/BTT/Move2DPawnCache.h"
 #include "BTT_MaintainDistance2D.generated.h"
 
+/** Per-BT-instance state (the node itself is shared by every enemy running this tree). */
+struct FBTMaintainDistance2DMemory
+{
+	FMove2DPawnCache Cache;
+	TWeakObjectPtr<AActor> Target;
+	float StartTime = 0.f;
+
+	// replaces TOptional
+	bool  bHasGoalX = false;
+	float GoalX = 0.f;
+};
+
 /**
  * Maintain a horizontal distance band to Target on XZ (side-scroller).
  * - Outside band: move in/out.
  * - Inside band: optionally pick ONE random strafe spot (after Fire requests it).
  * - Ground-snap via short downward trace.
+ * - Pawn components are cached in node memory on Execute; speed/state/facing are written only on change.
  */
 UCLASS()
 class BOTTOMLESSPIT_API UBTT_MaintainDistance2D : public UBTTaskNode
@@ -61,31 +73,18 @@ protected:
 	virtual void TickTask(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual EBTNodeResult::Type AbortTask(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 
-private:
-	TWeakObjectPtr<class APawn>  Pawn;
-	TWeakObjectPtr<class AActor> Target;
-	float StartTime = 0.f;
-
-	// replaces TOptional
-	bool  bHasGoalX = false;
-	float GoalX = 0.f;
+	virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTMaintainDistance2DMemory); }
+	virtual void InitializeMemory(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
+private:
 	// helpers (must match cpp exactly)
 	static float DistXZ(const FVector& A, const FVector& B);
-	void Snap(class APawn* P);
-	void Flip(class APawn* P, float DX);
-	bool ChooseNewStrafeGoal(class UWorld* W, const FVector& Me, const FVector& Player, float& OutGoalX);
-	bool ProjectGroundAtX(class UWorld* W, float X, float StartZ, float Y, FVector& OutGround) const;
-	bool HasLOSFrom(class UWorld* W, const FVector& From, const AActor* To) const;
-
-	static FORCEINLINE void SetAIMoveStateIfEnemy(APawn* P, EAIMovementState NewState)
-	{
-		if (ACPP_EnemyParent* E = Cast<ACPP_EnemyParent>(P))
-		{
-			E->SetAIMoveState(NewState);
-		}
-	}
-
+	void Snap(const FMove2DPawnCache& Cache) const;
+	void Flip(const FMove2DPawnCache& Cache, float DX) const;
+	bool ChooseNewStrafeGoal(class UWorld* W, const FVector& Me, const FVector& Player, const FBTMaintainDistance2DMemory& Mem, float& OutGoalX) const;
+	bool ProjectGroundAtX(class UWorld* W, float X, float StartZ, float Y, const class APawn* Ignore, FVector& OutGround) const;
+	bool HasLOSFrom(class UWorld* W, const FVector& From, const AActor* To, const class APawn* Ignore) const;
 };
 
 
@@ -4,8 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "BehaviorTree/BTTaskNode.h"
+#include "AI/BTT/Move2DPawnCache.h"
 #include "BTT_MoveTo2D.generated.h"
 
+struct FBTMoveTo2DMemory
+{
+	FMove2DPawnCache Cache;
+	TWeakObjectPtr<AActor> Target;
+	float StartTime = 0.f;
+};
+
 /**
  * 
  */
@@ -54,16 +62,15 @@ protected:
 	virtual void TickTask(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual EBTNodeResult::Type AbortTask(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 
-private:
-	TWeakObjectPtr<class APawn> CachedPawn;
-	TWeakObjectPtr<class AActor> CachedTarget;
-	float StartTime = 0.f;
+	virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTMoveTo2DMemory); }
+	virtual void InitializeMemory(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(class UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
+private:
 	// Helpers
 	static float Dist2D_XZ(const FVector& A, const FVector& B);
-	void MoveHorizontalToward(APawn* Pawn, const FVector& TargetLoc);
-	void SnapDownToGround(APawn* Pawn);
-	void UpdateFlip(APawn* Pawn, float DeltaX);
+	void MoveHorizontalToward(const FMove2DPawnCache& Cache, const FVector& TargetLoc) const;
+	void SnapDownToGround(const FMove2DPawnCache& Cache) const;
 };
 
 
@@ -3,11 +3,17 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Pawn/Enemy/CPP_EnemyParent.h"      
-#include "Enum/AIMovementState.h"   
 #include "BehaviorTree/BTTaskNode.h"
+#include "AI/BTT/Move2DPawnCache.h"
 #include "BTT_MoveToLocation2D_Snap.generated.h"
 
+struct FBTMoveToLocation2DMemory
+{
+	FMove2DPawnCache Cache;
+	FVector TargetLoc = FVector::ZeroVector;
+	float StartTime = 0.f;
+};
+
 /**
  * 
  */
@@ -35,24 +41,14 @@ protected:
 	virtual void TickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
 	virtual EBTNodeResult::Type AbortTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
 
-private:
-	TWeakObjectPtr<APawn> Pawn;
-	FVector TargetLoc;
-	float StartTime = 0.f;
+	virtual uint16 GetInstanceMemorySize() const override { return sizeof(FBTMoveToLocation2DMemory); }
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTMemoryClear::Type CleanupType) const override;
 
+private:
 	static float Dist2D_XZ(const FVector& A, const FVector& B);
-	void MoveHorizontalToward(APawn* P, const FVector& To);
-	void SnapDown(APawn* P);
-	void Flip(APawn* P, float DX);
-	
-	static FORCEINLINE void SetStateIfEnemy(APawn* P, EAIMovementState S)
-	{
-		if (ACPP_EnemyParent* E = Cast<ACPP_EnemyParent>(P))
-		{
-			E->SetAIMoveState(S);
-		}
-	}
-
+	void MoveHorizontalToward(const FMove2DPawnCache& Cache, const FVector& To) const;
+	void SnapDown(const FMove2DPawnCache& Cache) const;
 };
 
 
@@ -0,0 +1,39 @@
+﻿// Move2DPawnCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Enum/AIMovementState.h"
+
+class APawn;
+class ACPP_EnemyParent;
+class UFloatingPawnMovement;
+class UPaperFlipbookComponent;
+
+/**
+ * Pawn pieces the 2D move tasks touch every tick, looked up once in ExecuteTask.
+ * Lives in the task's node memory (one per BT instance), never on the shared node.
+ * Writes compare against the live value first, so other code changing speed/state stays authoritative.
+ */
+struct BOTTOMLESSPIT_API FMove2DPawnCache
+{
+	TWeakObjectPtr<APawn> Pawn;
+	TWeakObjectPtr<ACPP_EnemyParent> Enemy;            // null for non-enemy pawns
+	TWeakObjectPtr<UFloatingPawnMovement> Move;
+	TWeakObjectPtr<UPaperFlipbookComponent> Sprite;
+	float HalfHeight = 0.f;                            // scaled capsule half height (0 without capsule)
+
+	void Bind(APawn* InPawn);
+	void Reset() { *this = FMove2DPawnCache(); }
+
+	void SetState(EAIMovementState State) const;
+	void SetMaxSpeed(float Speed) const;
+
+	/** Speed for State from the enemy's Walk/Run speeds (Idle leaves it alone). */
+	void SetSpeedForState(EAIMovementState State) const;
+
+	void Stop() const;
+
+	/** Face +X for DX >= 0; ignores |DX| < 1 and skips the write when already facing that way. */
+	void Face(float DX) const;
+};
@@ -0,0 +1,150 @@
+﻿// DA_EnemyArchetypeFSM.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/EngineTypes.h"
+#include "DA_EnemyArchetypeFSM.generated.h"
+
+/** What a state does while it is current; each maps to the BTT_* behavior of the same job. */
+UENUM(BlueprintType)
+enum class EEnemyFSMAction : uint8
+{
+	Idle        UMETA(DisplayName = "Idle"),                 // stop, Idle anim
+	Patrol      UMETA(DisplayName = "Patrol"),               // BTT_Patrol2D + MoveToLocation2D_Snap
+	Chase       UMETA(DisplayName = "Chase"),                // BTT_MoveTo2D
+	HoldBand    UMETA(DisplayName = "Hold Band"),            // BTT_MaintainDistance2D (strafes after a shot)
+	Fire        UMETA(DisplayName = "Fire"),                 // BTT_FireIfLOS2D (one shot, then done)
+	Reposition  UMETA(DisplayName = "Reposition"),           // BTT_FindVantage2D + MoveToLocation2D_Snap
+	JumpUp      UMETA(DisplayName = "Jump Up")               // BTT_FindJumpSpot2D + JumpUp2D (platform graph only)
+};
+
+/** Checked against the latest perception result, the state timer and the action's outcome. */
+UENUM(BlueprintType)
+enum class EEnemyFSMCondition : uint8
+{
+	Always            UMETA(DisplayName = "Always"),
+	HasTarget         UMETA(DisplayName = "Has Target"),
+	NoTarget          UMETA(DisplayName = "No Target"),
+	HasLOS            UMETA(DisplayName = "Has LOS"),
+	NoLOS             UMETA(DisplayName = "No LOS"),
+	TargetCloserThan  UMETA(DisplayName = "Target Closer Than (Value)"),
+	TargetFartherThan UMETA(DisplayName = "Target Farther Than (Value)"),
+	TargetAbove       UMETA(DisplayName = "Target Above By (Value)"),
+	TimeInStateOver   UMETA(DisplayName = "Time In State Over (Value)"),
+	ActionSucceeded   UMETA(DisplayName = "Action Succeeded"),
+	ActionFailed      UMETA(DisplayName = "Action Failed"),
+	ActionDone        UMETA(DisplayName = "Action Done")
+};
+
+USTRUCT(BlueprintType)
+struct FEnemyFSMTransition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	EEnemyFSMCondition Condition = EEnemyFSMCondition::Always;
+
+	/** Distance / height / seconds, depending on Condition. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	float Value = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	FName ToState;
+};
+
+USTRUCT(BlueprintType)
+struct FEnemyFSMState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	EEnemyFSMAction Action = EEnemyFSMAction::Idle;
+
+	/** First matching transition wins; at most one transition per frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	TArray<FEnemyFSMTransition> Transitions;
+};
+
+/**
+ * Data-driven enemy brain run natively by UWS_EnemyFSM (no behavior tree, no blackboard).
+ * - Sense block mirrors UEnemyFSMComponent (acquire / lose / LOS through UWS_Perception2D).
+ * - Tuning blocks mirror the defaults of the BTT_* tasks the actions stand in for.
+ * - New assets start as the ranged-enemy tree: Idle -> HoldBand <-> Fire, Reposition / JumpUp without LOS.
+ */
+UCLASS(BlueprintType)
+class BOTTOMLESSPIT_API UDA_EnemyArchetypeFSM : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UDA_EnemyArchetypeFSM();
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	FName InitialState = TEXT("Idle");
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "FSM")
+	TArray<FEnemyFSMState> States;
+
+	// ---- Sense (UEnemyFSMComponent) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense", meta = (ClampMin = "0.02"))
+	float SenseInterval = 0.15f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense") float SightRange = 2000.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense") float EyeHeight = 30.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense") TEnumAsByte<ECollisionChannel> LOSChannel = ECC_Visibility;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense") float AcquireRange = 1800.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense") bool  bRequireLOSForAcquire = true;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Sense") float LoseTargetTime = 1.0f;
+
+	// ---- Move (MoveTo2D / MoveToLocation2D_Snap) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Move") float AcceptRadius = 100.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Move") float MoveMaxTime = 8.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Move") bool  bSnapToGround = true;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Move") float GroundTrace = 300.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Move") TEnumAsByte<ECollisionChannel> GroundChannel = ECC_Visibility;
+
+	// ---- Band (MaintainDistance2D) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") float PreferMin = 450.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") float PreferMax = 550.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") float BandEpsilon = 40.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") bool  bStrafeAfterShot = true;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") float MinStrafeDeltaX = 200.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") float StrafeJitter = 80.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Band") float StrafeEpsilon = 50.f;
+
+	// ---- Patrol (Patrol2D) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Patrol") float MinPatrolDistance = 200.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Patrol") float MaxPatrolDistance = 600.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Patrol") int32 PatrolAttempts = 6;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Patrol") float SameFloorTolerance = 24.f;
+
+	// ---- Reposition (FindVantage2D) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reposition") float VantageMaxDistance = 1600.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reposition") float VantageStep = 120.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reposition") float VantageFloorTolerance = 80.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reposition") float VantageMinDeltaX = 200.f;
+
+	// ---- Fire (FireIfLOS2D) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire") float AttackRange = 900.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire") float FireCooldown = 3.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire") bool  bFaceTargetOnFire = true;
+
+	// ---- Jump (FindJumpSpot2D / JumpUp2D) ----
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Jump") float JumpSearchDistance = 1200.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Jump") float MaxJumpRise = 260.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Jump") float Gravity = 1200.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Jump") float MaxJumpSpeed = 1800.f;
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Jump") float JumpMaxTime = 2.f;
+
+	/** State index by name (INDEX_NONE when missing). */
+	int32 FindState(FName StateName) const;
+
+	/** Replace States with the ranged-enemy layout the behavior trees use. */
+	UFUNCTION(CallInEditor, Category = "FSM")
+	void ResetToRangedDefaults();
+};
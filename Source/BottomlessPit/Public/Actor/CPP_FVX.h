@@ -120,6 +120,13 @@ protected:
 	
 
 private:	
+	friend class UWS_FVXPool;
+
+	// Native pool bookkeeping (PoolRow is None for BP-pooled instances)
+	FName  PoolRow = NAME_None;
+	uint32 PoolSerial = 0;
+	bool   bPoolLive = false;
+
 	FTimerHandle FVXTimer;
 	FTimerHandle TrailFadeTimer;
 	float        TrailFadeStartTime = 0.f;
@@ -152,22 +159,13 @@ private:
 		return FMath::Clamp(t, 0.f, 1.f);
 	}
 
-	UPROPERTY()
-	TMap<FName, FVFXAnimationResolved> CachedRows;
-
-	UPROPERTY() // keep loaders alive
-	TMap<FName, TObjectPtr<UUtil_BpAsyncVFXFlipbooks>> InFlight;
-
-	// Pending requests while a row is loading
-	TMap<FName, TArray<FVector>> PendingLocations;
-	TMap<FName, TArray<FTransform>> PendingTransforms;
+	// Latest by-name request still waiting on the shared row cache (last one wins)
+	FName      PendingRow = NAME_None;
+	FTransform PendingTransform;
+	bool       bPendingFace = false;
 
-	// Loader callbacks
-	UFUNCTION()
-	void OnLoaderCompleted(FName RowName, const FVFXAnimationResolved& VFX);
-
-	UFUNCTION()
-	void OnLoaderFailed();
+	void RequestSharedRow(FName RowName, const FTransform& WorldTransform, bool bAllowFace);
+	void OnSharedRowResolved(const FVFXAnimationResolved* Resolved, FName RowName);
 
 	// Internal play helpers
 	void PlayResolvedInternal(const FVFXAnimationResolved& Resolved, const FTransform& WorldTransform, bool bAllowFace);
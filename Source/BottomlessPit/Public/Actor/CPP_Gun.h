@@ -7,6 +7,7 @@
 #include "PaperFlipbookComponent.h"
 #include "PaperFlipbook.h"
 #include "GameFramework/DamageType.h"
+#include "WorldCollision.h"
 #include "CPP_Gun.generated.h"
 
 UCLASS()
@@ -52,6 +53,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Weapon")
 	void CoreHitscanFromMuzzle_PastCursor();
 
+	// ---------- Batched hitscan ----------
+
+	/** Trace every direction from the muzzle in one call. Hits are ordered by distance per ray,
+	 *  damaged in bulk and handed to ShootOnHitBatch. Resolves next frame when bAsyncHitscan is set. */
+	UFUNCTION(BlueprintCallable, Category = "Weapon")
+	void CoreHitscanBatch(const TArray<FVector>& AimDirs);
+
+	/** Evenly fanned volley of RayCount rays across SpreadAngleDeg around AimDir (XZ plane). */
+	UFUNCTION(BlueprintCallable, Category = "Weapon")
+	void CoreHitscanSpreadFromMuzzle(const FVector& AimDir, int32 RayCount, float SpreadAngleDeg);
+
+	/** Same cursor gate as CoreHitscanFromMuzzle_PastCursor, fanned into a volley. */
+	UFUNCTION(BlueprintCallable, Category = "Weapon")
+	void CoreHitscanSpreadFromMuzzle_PastCursor(int32 RayCount, float SpreadAngleDeg);
+
+	// Enemies hit per ray after the first (0 = stop at first hit). Non-pawn hits always stop the ray.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire|Batch", meta = (ClampMin = "0"))
+	int32 MaxPenetrations = 0;
+
+	// Queue traces on the async scene query and resolve them next frame instead of stalling the game thread
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Fire|Batch")
+	bool bAsyncHitscan = false;
+
 	// add this toggle & small epsilon if you like
 	UPROPERTY(EditAnywhere, Category = "Fire")
 	bool bPreventBackwardShots = true;
@@ -73,6 +97,10 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Fire")
 	void ShootOnHit(FHitResult ShootResult);
 
+	// Every hit of one batch, ray by ray and near-to-far. Default calls ShootOnHit per hit.
+	UFUNCTION(BlueprintNativeEvent, Category = "Fire")
+	void ShootOnHitBatch(const TArray<FHitResult>& ShootResults);
+
 	//Hit Event Variable
 
 	UPROPERTY(EditAnywhere, Category = "Fire|HitVariable")
@@ -90,7 +118,36 @@ protected:
 	virtual void Tick(float DeltaTime) override;
 
 	bool GetCursorWorldOnOwnerPlane(FVector& OutWorld) const;
-	
+
+	// Muzzle-forward / cursor gate shared by the single and spread past-cursor shots
+	bool ResolvePastCursorAimDir(FVector& OutDir) const;
+
+private:
+	struct FHitscanRay
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector Dir = FVector::ForwardVector;
+		FVector End = FVector::ZeroVector;
+		FTraceHandle Handle;
+		TArray<FHitResult> Hits;
+	};
+
+	struct FHitscanBatch
+	{
+		TArray<FHitscanRay> Rays;
+		int32 Remaining = 0;
+	};
+
+	TMap<uint32, FHitscanBatch> PendingHitscanBatches;
+	uint32 NextHitscanBatchId = 1;
+	FTraceDelegate HitscanTraceDelegate;
+
+	FCollisionQueryParams MakeHitscanQueryParams() const;
+	FCollisionResponseParams MakeHitscanResponseParams() const;
+	void FilterPenetrationHits(TArray<FHitResult>& InOutHits) const;
+	void OnAsyncHitscanTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void ResolveHitscanBatch(FHitscanBatch& Batch);
+
 
 };
 
@@ -4,11 +4,14 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Utility/Util_BpAsyncProjectileFlipbooks.h"
+#include "Utility/Util_BpAsyncFireModeProfile.h"
+#include "Subsystem/WS_SpatialHash2D.h"
 #include "CPP_ProjectileParent.generated.h"
 
 class USphereComponent;
 class UPaperFlipbookComponent;
 class UPaperFlipbook;
+class ALaneLevelGenerator;
 
 UENUM(BlueprintType)
 enum class EProjectileFlipbookState : uint8
@@ -62,6 +65,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Projectile|Control")
 	void FireFromBP(const FVector& StartLocation);
 
+	/** Arm from a gun-built descriptor: no gun lookup, no profile copy, no random roll. */
+	void FireWithLaunch(const FVector& StartLocation, AActor* InstigatorActor, const FProjectileLaunch& Launch);
+
+	/** Blueprint convenience: uses Owner or Instigator as instigator. */
+	UFUNCTION(BlueprintCallable, Category = "Projectile|Control")
+	void FireWithLaunchBP(const FVector& StartLocation, const FProjectileLaunch& Launch);
+
 	// ---------- Control / Pooling ----------
 	/** Immediately stop and return to pool (skips impact). */
 	UFUNCTION(BlueprintCallable, Category = "Projectile|Pooling")
@@ -111,13 +121,32 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Control")
 	bool bAutoImpactOnHit = false;
 
+	/** Test level geometry against the generator's lane collision index; physics only sweeps for pawns. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Collision")
+	bool bUseLaneCollisionIndex = true;
+
+	/** Indexed steps only run the pawn sweep when UWS_SpatialHash2D has an enemy/player box along the step. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Collision")
+	bool bUsePawnBroadphase = true;
+
+	/** Added to the hash query radius; covers movement since the last hash refresh (every frame, tick LOD included). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile|Collision", meta = (ClampMin = "0"))
+	float PawnBroadphaseSlackUU = 64.f;
+
 private:
 	// Movement core
 	void StepMove(float Dt);
+	bool StepMoveIndexed(const FVector& Delta); // true if the step ended in a hit
+	bool AnyPawnAlong(const FVector& Start, const FVector& End, float Radius);
+	TArray<FSpatialHit2D> PawnCandidates;   // broadphase scratch, reused every step
+	void ResolveLaneIndex();
 	void StartFixedStep();
 	void StopFixedStep();
 
 	// Lifecycle
+	void ResetForFire(const FVector& StartLocation, AActor* InstigatorActor);
+	void SetVisualScale(float Scale);
+	void CacheVisualScale();
 	void ArmAndGo();
 	void Disarm();
 	void Deactivate_Internal(); // central return-to-pool path (no Destroy)
@@ -154,6 +183,22 @@ private:
 	// Distance tracking
 	float TraveledDistance = 0.f;
 
+	// Level collision index (looked up once) + pawns already pierced this flight
+	TWeakObjectPtr<ALaneLevelGenerator> LaneIndex;
+	bool bLaneIndexSearched = false;
+
+	// Row values shadowed by FireWithLaunch; put back on pool return so the next shot starts clean
+	void SnapshotLaunchDefaults();
+	void RestoreLaunchDefaults();
+	bool bLaunchOverridesApplied = false;
+	float SavedSpeed = 0.f;
+	float SavedMaxLifeSeconds = 0.f;
+	float SavedDamage = 0.f;
+	bool  bSavedAutoImpactOnHit = false;
+	UPROPERTY(Transient) UPaperFlipbook* SavedSpawnFlipbook = nullptr;
+	UPROPERTY(Transient) UPaperFlipbook* SavedLoopFlipbook = nullptr;
+	UPROPERTY(Transient) UPaperFlipbook* SavedImpactFlipbook = nullptr;
+
 	FTimerHandle LifeTimerHandle;
 	FTimerHandle FixedStepTimerHandle;
 	float        FixedStepDt = 0.f;
@@ -161,6 +206,11 @@ private:
 	UFUNCTION()
 	void FixedStepTick();
 
+	// Visual's Blueprint-authored relative scale (BeginPlay), restored on Disarm
+	FVector AuthoredVisualScale = FVector::OneVector;
+	// Visual's current uniform world scale (skips the transform update when unchanged); < 0 = non-uniform
+	float AppliedVisualScale = -1.f;
+
 	// Visual state
 	EProjectileFlipbookState FlipState = EProjectileFlipbookState::None;
 
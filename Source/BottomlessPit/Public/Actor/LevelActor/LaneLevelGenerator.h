@@ -7,6 +7,7 @@
 #include "Actor/LevelActor/PlatformStrip.h"
 #include "PaperSprite.h"
 #include "Pawn/Enemy/CPP_EnemyParent.h"
+#include "Subsystem/WS_PlatformGraph2D.h"
 #include "LaneLevelGenerator.generated.h"
 
 class UPaperSprite;
@@ -14,6 +15,34 @@ class UBoxComponent;
 class APlatformStrip;
 class ACPP_EnemyParent; // fwd
 
+// ---------- Collision index ----------
+// Strips are axis-aligned, so bullet-vs-level only needs boxes on the game plane (world X/Z).
+
+/** One solid piece of a strip. Breakable tiles get their own span so a break just flips it off. */
+struct FLaneCollisionSpan
+{
+	float MinX = 0.f;
+	float MaxX = 0.f;
+	float MinZ = 0.f;
+	float MaxZ = 0.f;
+	TWeakObjectPtr<APlatformStrip> Strip;
+	int32 TileIndex = INDEX_NONE;   // breakable tile covered by this span (INDEX_NONE = always solid)
+};
+
+/** Per-row index published by the generator; lives and dies with its row. */
+struct FLaneRowCollision
+{
+	float MinZ = FLT_MAX;           // row band (union of its spans)
+	float MaxZ = -FLT_MAX;
+	TArray<FLaneCollisionSpan> Spans;
+
+	void ShiftZ(float DeltaZ)
+	{
+		MinZ += DeltaZ; MaxZ += DeltaZ;
+		for (FLaneCollisionSpan& S : Spans) { S.MinZ += DeltaZ; S.MaxZ += DeltaZ; }
+	}
+};
+
 UCLASS()
 class BOTTOMLESSPIT_API ALaneLevelGenerator : public AActor
 {
@@ -30,6 +59,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Platforms")
 	bool bSpawnPlatforms = false;
 
+	/** Sphere sweep against the live rows' collision index + side walls. No physics query. */
+	bool SweepCollisionIndex(const FVector& Start, const FVector& End, float Radius, FHitResult& OutHit) const;
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -348,6 +380,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Enemies")
 	float FlyerSpawnAboveZ = 220.f;   // spawn flyers higher up than platforms
 
+	// walk/drop/jump reach used when linking strips into the platform graph (BT tasks query it)
+	UPROPERTY(EditAnywhere, Category = "Enemies|Graph")
+	FPlatformGraphLimits EnemyGraphLimits;
+
 	// PoolEnemies
 	UPROPERTY(EditAnywhere, Category = "Enemies|Pool") int32 PoolSize_Walker = 12;
 	UPROPERTY(EditAnywhere, Category = "Enemies|Pool") int32 PoolSize_Flyer = 8;
@@ -489,6 +525,7 @@ private:
 		int64  RowIndex = 0;
 		float  LocalY = 0.f;
 		TArray<TWeakObjectPtr<APlatformStrip>> Actors;
+		FLaneRowCollision Collision;
 	};
 
 	TArray<FRowBit> LiveRows;
@@ -496,6 +533,9 @@ private:
 	// (optional) small helper:
 	void DespawnRow(FRowBit& Row);
 
+	// Fill Row.Collision from its spawned strips (call once the strips are placed)
+	void BuildRowCollision(FRowBit& Row) const;
+
 	float ExtraPlatformChance() const
 	{
 		const float t = FMath::Clamp(DepthScreens() / FMath::Max(DepthAtMax_Platforms, 1.f), 0.f, 1.f);
@@ -21,9 +21,13 @@ enum class EPlatformKind : uint8 { Solid, Breakable, SpikeTop };
 
 class UBoxComponent;
 class UPaperSpriteComponent;
+class APlatformStrip;
 struct FDamageEvent;
 struct FPointDamageEvent;
 
+// Fired after tiles break (solid spans changed); walkers bound to the strip re-read their span
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnStripSpansChanged, APlatformStrip* /*Strip*/);
+
 UCLASS()
 class BOTTOMLESSPIT_API APlatformStrip : public AActor
 {
@@ -163,6 +167,27 @@ public:
     UFUNCTION(BlueprintPure, Category = "Platform|Spawn")
     bool GetRandomSpawnPoint(int32& OutTileIdx, FVector& OutWorld, float HoverZ = 8.f, int32 ExcludeEdgeTiles = 1) const;
 
+    //CollisionIndex (read by ALaneLevelGenerator)
+
+    int32 GetBuiltTileCount() const { return BuiltCount; }
+    bool IsTileBreakable(int32 TileIndex) const { return TileIsBreakable.IsValidIndex(TileIndex) && TileIsBreakable[TileIndex]; }
+    bool IsTileBroken(int32 TileIndex) const { return TileIsBroken.IsValidIndex(TileIndex) && TileIsBroken[TileIndex]; }
+
+    // World AABB of tiles [FirstTile..LastTile] using the current collider height/depth
+    FBox GetTileSpanWorldBox(int32 FirstTile, int32 LastTile) const;
+
+    // World AABB of the whole-strip collider (strips built without per-tile bookkeeping)
+    FBox GetCollisionWorldBox() const;
+
+    // Walk span (no traces): the contiguous solid tiles under WorldX as a world X range + top Z.
+    // Strips built without per-tile bookkeeping return the whole collider. False over a hole / off the strip.
+    bool GetSolidSpanAtWorldX(float WorldX, float& OutMinX, float& OutMaxX, float& OutTopZ) const;
+
+    // Every solid span as a world AABB, left to right (one box for strips without per-tile bookkeeping)
+    void GetSolidSpansWorld(TArray<FBox>& OutSpans) const;
+
+    FOnStripSpansChanged OnSpansChanged;
+
 protected:
     UPROPERTY(VisibleAnywhere) USceneComponent* Root;
     UPROPERTY(VisibleAnywhere) UBoxComponent* Box;
@@ -19,7 +19,8 @@ class BOTTOMLESSPIT_API ACPP_PaperZDParentCharacter : public APaperZDCharacter
 
 
 public:
-    ACPP_PaperZDParentCharacter();
+    // Player characters move with UMovement2DComponent (swept-AABB X/Z solver) instead of the stock CharacterMovement
+    ACPP_PaperZDParentCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
     // Function to update controller rotation based on movement
     UFUNCTION(BlueprintCallable, Category = "Movement") // Added UFUNCTION
@@ -38,6 +39,7 @@ public:
     AController* MyControllerComp;
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaTime) override;
 
     // === Shared movement state (parent owns it) ===
@@ -75,6 +77,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Tuning")
     float IdleConfirmDelay = 0.08f;
 
+    /** Directional intent must last this long before Walk is committed (0 = next tick) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Tuning")
+    float WalkCommitDelay = 0.f;
+
     /** If AnimSpeedX > this, we keep/enter Walk even if inputs flicker */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Tuning")
     float WalkSpeedThreshold = 50.f;
@@ -87,7 +93,7 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Anim|Tuning")
     float SpeedEpsilon = 2.0f;
 
-    /** Simple helper: -1/0/+1 axis intent -> manages Walk/Idle timers */
+    /** Simple helper: -1/0/+1 axis intent -> requests Walk / idle confirmation */
     UFUNCTION(BlueprintCallable, Category = "Movement")
     void HandleAxisIntent(int32 CombinedAxis /* -1,0,+1 */);
 
@@ -128,7 +134,7 @@ protected:
     // If children need a hook on state changes without binding to the multicast:
     virtual void OnMovementStateChangedNative(EE_PlayerMovementState OldState, EE_PlayerMovementState NewState) {}
 
-    // Idle confirm lifecycle
+    // Idle confirm / walk commit lifecycle: input only stamps times, Tick (EvaluateLocomotion) resolves them
     UFUNCTION(BlueprintCallable, Category = "Movement|Idle")
     void ScheduleIdleConfirm();
 
@@ -138,6 +144,13 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Movement|Idle")
     void ClearIdleConfirmTimer();
 
+    /** Grounded directional intent: Walk from Idle after WalkCommitDelay (cancels a pending idle; any other state change drops it) */
+    UFUNCTION(BlueprintCallable, Category = "Movement|Idle")
+    void RequestWalk();
+
+    UFUNCTION(BlueprintCallable, Category = "Movement|Idle")
+    void CancelWalkCommit() { WalkIntentSince = -1.0; }
+
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|State")
     int MaxJumpCount = 2;
 
@@ -188,7 +201,11 @@ protected:
 
 
 private:
-    FTimerHandle IdleConfirmTimer;
+    // < 0 = nothing pending (world seconds)
+    double IdleConfirmAt = -1.0;
+    double WalkIntentSince = -1.0;
+
+    void EvaluateLocomotion();
 
     
 
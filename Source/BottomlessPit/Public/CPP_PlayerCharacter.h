@@ -181,9 +181,6 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly, Category = "Player Controls", meta = (DisplayPriority = 1))
 	APlayerController* CachedPlayerController;
 
-	UPROPERTY(EditAnywhere, Category = "Movement|Tuning")
-	float WalkCommitDelay = 0.03f;
-
 	UFUNCTION(BlueprintNativeEvent, Category = "Movement")
 	void CustomEventOnLanded(FHitResult HitResult);
 
@@ -219,8 +216,6 @@ private:
 	float TimeSinceInputReleased = 0.f;
 	float LastNonZeroAxis = 0.f;
 	double LastInputPressedTime = 0.0;
-	FTimerHandle IdleConfirmTimer;
-	FTimerHandle WalkCommitTimer;
 
 	//UPROPERTY()
 
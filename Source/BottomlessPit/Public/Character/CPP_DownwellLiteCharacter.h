@@ -26,6 +26,10 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Movement")
 	void CustomEventOnLanded(FHitResult HitResult);
 
+	/** Stomp sensor swept into Enemy during a fall while stomp is active (once per enemy per fall). Default applies StompDamage. */
+	UFUNCTION(BlueprintNativeEvent, Category = "Stomp")
+	void CustomEventOnStomp(AActor* Enemy, FHitResult HitResult);
+
 	// Called by the Downwell controller
 	void SetMoveAxis(float InAxis);
 	void InputJumpPressed();
@@ -86,18 +90,16 @@ protected :
 	void JumpFunction();
 
 	// --- Tunables ---
-	UPROPERTY(EditAnywhere, Category = "Stomp")
-	float StompMonitorInterval = 0.01f;     // how often to poll Vz while arming
-
 	UPROPERTY(EditAnywhere, Category = "Stomp")
 	float StompMinDownSpeed = 300.f;        // arm when Vz < -this
 
 	UPROPERTY(EditAnywhere, Category = "Stomp|Damage")
-	float StompDamage = 1.f;                 // (use in BP overlap if you want)
+	float StompDamage = 1.f;                 // applied by CustomEventOnStomp
 
 	UPROPERTY(EditAnywhere, Category = "Stomp|Collision")
 	TEnumAsByte<ECollisionChannel> EnemyChannel = ECC_GameTraceChannel1;
 
+	// Shape/offset of the stomp query only; it never collides or overlaps itself
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stomp|Sensor")
 	UBoxComponent* StompSensor = nullptr;
 
@@ -107,17 +109,17 @@ protected :
 	UPROPERTY(EditAnywhere, Category = "Stomp|Sensor")
 	FVector StompSensorExtent = FVector(20.f, 10.f, 10.f);
 
-	// Timers/state
-	FTimerHandle Timer_StompMonitor;
-
-	// internals
-	void StompMonitorTick();
+	// internals (raised by UMovement2DComponent's fall step, no timer)
+	void HandleFallSpeedReached();
+	void HandleFallStep(const FVector& From, const FVector& To);
 	void BeginStompActive();         // latched ON until Landed
-	void SetStompCollisionEnabled(bool bEnabled);
 
 	bool bStompActive = false;
 	float LastStompTime = -1000.f;
 
+	// enemies already stomped during the current activation
+	TArray<TWeakObjectPtr<AActor>> StompedThisFall;
+
 	
 private:
 	
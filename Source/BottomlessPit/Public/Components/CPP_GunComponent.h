@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Utility/Util_BpAsyncFireModeProfile.h"
+#include "Utility/Util_BpAsyncProjectileFlipbooks.h"
 #include "CPP_GunComponent.generated.h"
 
 
@@ -32,6 +33,14 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Gun|Fire")
 	void OnRequestSpawnShot(FVector ShotDir, FName ProjectileRowName, bool bPenetrate, float ProjectileScale, float DamagePerProjectile, float ProjectileLifeSecondsOverride);
 
+	/** Launch-descriptor path (bUseLaunchDescriptors): hand Launch straight to ACPP_ProjectileParent::FireWithLaunch. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Gun|Fire")
+	void OnRequestLaunchShot(const FProjectileLaunch& Launch, FName ProjectileRowName);
+
+	/** Flipbooks baked into every launch descriptor (call once the projectile row is loaded). */
+	UFUNCTION(BlueprintCallable, Category = "Gun|FireMode")
+	void SetLaunchFlipbooks(const FProjectileAnimResolved& ProjectileConfig);
+
 	UFUNCTION(BlueprintCallable, Category = "Gun | Profile")
 	FFireModeProfile GetCurrentProfile() const { return  CurrentProfile; }
 
@@ -46,6 +55,9 @@ public:
 	bool CanBeginTrigger();
 	virtual bool CanBeginTrigger_Implementation();
 
+protected:
+	virtual void BeginPlay() override;
+
 private:
 	// cadence
 	UPROPERTY(EditAnywhere, Category = "Gun|FireMode")
@@ -64,6 +76,14 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Gun|FireMode", meta = (AllowPrivateAccess = "true"))
 	FName CurrentProjectileRowName;
 
+	/** Fire OnRequestLaunchShot (precomputed descriptor) instead of OnRequestSpawnShot. */
+	UPROPERTY(EditAnywhere, Category = "Gun|Fire", meta = (AllowPrivateAccess = "true"))
+	bool bUseLaunchDescriptors = false;
+
+	FProjectileLaunch BaseLaunch;
+
+	void RebuildLaunchTemplate();
+
 	// internal logic
 	void FireAccordingToMode();           // C++ handles mode branching
 	void FireVolley(int32 Count);         // spawns N “shots” via OnRequestSpawnShot
@@ -51,6 +51,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FSM")
 	void StartFSM();
 
+	/** Stretch the sense interval (>= 1); used by UWS_EnemyLOD for off-screen enemies. */
+	void SetSenseScale(float Scale);
+
 	// Acquire / lose tuning
 	UPROPERTY(EditAnywhere, Category = "Acquire")
 	float AcquireRange = 1800.f;              // how close before we “lock on”
@@ -73,6 +76,7 @@ private:
 
 	FTimerHandle SenseTimer;
 	FTimerHandle InitRetryTimer;
+	float SenseScale = 1.f;
 
 	// Core
 	void SenseAndDecide();            // runs at LOSInterval
@@ -0,0 +1,112 @@
+﻿// Movement2DComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Movement2DComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWallContact2DChanged, bool, bTouchingWall, float, WallNormalX);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnFallStep2D, const FVector& /*From*/, const FVector& /*To*/);
+
+/**
+ * Walking/falling for the X/Z plane as two swept AABB moves per frame (X, then Z).
+ * - Replaces the capsule floor search / step-up / slide solver; MovementMode still reads Walking/Falling,
+ *   so IsGrounded, Jump/JumpMaxCount and Landed -> CustomEventOnLanded behave as before.
+ * - Gravity: GetGravityZ() (GravityScale applies), clamped to the volume's terminal velocity.
+ * - Smash-down: fixed downward speed with X locked until the next landing.
+ * - One-way platforms: components (or actors) tagged OneWayTag only block a downward move that starts above them.
+ * - Wall contact: set when the X move is blocked by a near-vertical surface; OnWallContactChanged on change.
+ * - Fall hooks (native): OnFallSpeedReached once per WatchFallSpeed, OnFallStep for every downward falling step
+ *   (raised before landing is processed, so a stomp on the landing frame still counts).
+ * Any other movement mode (flying, custom, root motion) falls through to UCharacterMovementComponent.
+ */
+UCLASS(ClassGroup = (Movement), meta = (BlueprintSpawnableComponent))
+class BOTTOMLESSPIT_API UMovement2DComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Off = stock CharacterMovement walking/falling (A/B switch). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement2D")
+	bool bUseKinematic2D = true;
+
+	/** Gap kept between the box and whatever blocked it (matches CharacterMovement's floor distance). */
+	UPROPERTY(EditAnywhere, Category = "Movement2D", meta = (ClampMin = "0.1"))
+	float SkinWidth = 2.15f;
+
+	/** How far below the feet a floor still counts as "under us" while walking (snapped down to). */
+	UPROPERTY(EditAnywhere, Category = "Movement2D", meta = (ClampMin = "0"))
+	float FloorProbeDistance = 6.f;
+
+	/** Downward speed while smashing. 0 = StartSmashDown does nothing (BP drives gravity instead). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement2D|SmashDown", meta = (ClampMin = "0"))
+	float SmashDownSpeed = 0.f;
+
+	UPROPERTY(EditAnywhere, Category = "Movement2D|OneWay")
+	FName OneWayTag = TEXT("OneWay");
+
+	/** How long DropThrough ignores one-way platforms. */
+	UPROPERTY(EditAnywhere, Category = "Movement2D|OneWay", meta = (ClampMin = "0"))
+	float DropThroughSeconds = 0.25f;
+
+	UPROPERTY(BlueprintAssignable, Category = "Movement2D")
+	FOnWallContact2DChanged OnWallContactChanged;
+
+	UFUNCTION(BlueprintCallable, Category = "Movement2D|SmashDown")
+	void StartSmashDown();
+
+	UFUNCTION(BlueprintCallable, Category = "Movement2D|SmashDown")
+	void StopSmashDown() { bSmashingDown = false; }
+
+	UFUNCTION(BlueprintPure, Category = "Movement2D|SmashDown")
+	bool IsSmashingDown2D() const { return bSmashingDown; }
+
+	/** Fall through the one-way platform we stand on. */
+	UFUNCTION(BlueprintCallable, Category = "Movement2D|OneWay")
+	void DropThrough();
+
+	UFUNCTION(BlueprintPure, Category = "Movement2D")
+	bool IsTouchingWall() const { return bTouchingWall; }
+
+	/** +1 = wall on our left (normal points right), -1 = wall on our right, 0 = none. */
+	UFUNCTION(BlueprintPure, Category = "Movement2D")
+	float GetWallNormalX() const { return WallNormalX; }
+
+	/** Raise OnFallSpeedReached (once) the first falling step faster than MinDownSpeed. */
+	void WatchFallSpeed(float MinDownSpeed) { FallWatchSpeed = MinDownSpeed; }
+	void ClearFallWatch() { FallWatchSpeed = -1.f; }
+	bool IsWatchingFallSpeed() const { return FallWatchSpeed >= 0.f; }
+
+	FSimpleMulticastDelegate OnFallSpeedReached;
+	FOnFallStep2D OnFallStep;
+
+protected:
+	virtual void PhysWalking(float deltaTime, int32 Iterations) override;
+	virtual void PhysFalling(float deltaTime, int32 Iterations) override;
+	virtual void ProcessLanded(const FHitResult& Hit, float remainingTime, int32 Iterations) override;
+
+private:
+	bool bSmashingDown = false;
+	bool bTouchingWall = false;
+	float WallNormalX = 0.f;
+	float DropThroughUntil = -1.f;
+	float FallWatchSpeed = -1.f;
+
+	// start of the current falling step until its hooks have fired (stock solver lands inside Super)
+	FVector FallStepFrom = FVector::ZeroVector;
+	bool bFallStepPending = false;
+
+	/** Sweep the box by Delta without moving; one-way platforms are skipped unless they block a landing. */
+	bool Sweep2D(const FVector& Delta, FHitResult& OutHit) const;
+
+	/** Sweep and move by Delta, stopping SkinWidth short of a blocking hit. */
+	bool MoveAxis2D(const FVector& Delta, FHitResult& OutHit);
+
+	bool IsOneWay(const FHitResult& Hit) const;
+	bool IsWalkable2D(const FHitResult& Hit) const { return Hit.ImpactNormal.Z >= GetWalkableFloorZ(); }
+
+	void MoveHorizontal2D(float DeltaX);
+	void SetWallContact(bool bTouching, float NormalX);
+	void NotifyFallStep(const FVector& From);
+};
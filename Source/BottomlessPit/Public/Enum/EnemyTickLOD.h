@@ -0,0 +1,11 @@
+﻿#pragma once
+#include "CoreMinimal.h"
+#include "EnemyTickLOD.generated.h"
+
+UENUM(BlueprintType)
+enum class EEnemyTickLOD : uint8
+{
+    Near  UMETA(DisplayName = "Near"),    // on screen, full rate
+    Mid   UMETA(DisplayName = "Mid"),     // just off screen, or over the on-screen budget
+    Far   UMETA(DisplayName = "Far")      // well outside the visible band
+};
@@ -4,6 +4,8 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "Delegates/DelegateCombinations.h"
+#include "Subsystem/WS_EnemyLOD.h"
+#include "Subsystem/WS_EnemyActivation.h"
 #include "CPP_GM_BottomlessPit.generated.h"
 
 USTRUCT(BlueprintType)
@@ -20,6 +22,11 @@ struct FComboMultiplierStep
     float Multiplier = 1.0f;
 };
 
+class UDataTable;
+class ACPP_FVX;
+class UStaticMesh;
+class UMaterialInterface;
+
 // Declare your delegate outside the class declaration
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScoreUpdated, float, NewScore);
 
@@ -75,6 +82,73 @@ public:
     // Keep track of the "next target depth"
     float NextScoreThresholdZ;
 
+    // ---- Fire modes ----
+
+    // Every row is resolved into the fire-mode registry at BeginPlay (pickups become a lookup)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "FireMode")
+    UDataTable* FireModeTable = nullptr;
+
+    // Projectiles spawned per mode once the registry is ready; leave 0 unless shots go through AcquireProjectile
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "FireMode", meta = (ClampMin = "0"))
+    int32 ProjectilePrewarmPerMode = 0;
+
+    // ---- VFX pool ----
+
+    // Prewarmed per row of VFXTable at BeginPlay (leave unset to keep the BP pool)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX")
+    TSubclassOf<ACPP_FVX> FVXClass;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX")
+    UDataTable* VFXTable = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX", meta = (ClampMin = "1"))
+    int32 FVXPrewarmPerRow = 4;
+
+    // Batched tracer renderer (leave mesh unset to keep per-FVX trail sprites)
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Trail")
+    UStaticMesh* TrailQuadMesh = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Trail")
+    UMaterialInterface* TrailMaterial = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Trail", meta = (ClampMin = "1"))
+    int32 TrailCapacity = 256;
+
+    // Instanced impacts: VFXTable rows listed here render as sheet instances instead of FVX actors
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Impact")
+    UStaticMesh* ImpactQuadMesh = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Impact")
+    UMaterialInterface* ImpactSheetMaterial = nullptr;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Impact")
+    TArray<FName> InstancedImpactRows;
+
+    // 0 = read each row's sheet width from its own atlas
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Impact", meta = (ClampMin = "0"))
+    int32 ImpactSheetColumns = 0;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "VFX|Impact", meta = (ClampMin = "1"))
+    int32 ImpactCapacityPerRow = 128;
+
+    // ---- Enemy tick LOD ----
+
+    // Off-screen enemies tick, animate and sense at reduced rates
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|LOD")
+    bool bUseEnemyTickLOD = true;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|LOD", meta = (EditCondition = "bUseEnemyTickLOD"))
+    FEnemyLODSettings EnemyLODSettings;
+
+    // ---- Enemy activation queue ----
+
+    // Pool activations are spread over frames instead of landing with the row that spawned them
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|Pool")
+    bool bBudgetEnemyActivation = true;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|Pool", meta = (EditCondition = "bBudgetEnemyActivation"))
+    FEnemyActivationSettings EnemyActivationSettings;
+
     // Combo
     UFUNCTION(BlueprintCallable, Category = "Combo")
     void AddCombo(float Amount);
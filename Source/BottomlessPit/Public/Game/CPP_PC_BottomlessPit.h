@@ -6,15 +6,53 @@
 #include "GameFramework/PlayerController.h"
 #include "CPP_PC_BottomlessPit.generated.h"
 
+/** The cursor as seen this frame, projected once by the player controller. */
+USTRUCT(BlueprintType)
+struct FCursorSample2D
+{
+	GENERATED_BODY()
+
+	/** False when the mouse could not be deprojected (no viewport / no mouse). */
+	UPROPERTY(BlueprintReadOnly, Category = "Cursor") bool bValid = false;
+
+	/** Cursor ray intersected with the pawn's X/Z plane (Y = pawn Y). */
+	UPROPERTY(BlueprintReadOnly, Category = "Cursor") FVector WorldOnPlane = FVector::ZeroVector;
+
+	/** Pawn -> cursor on the plane, normalized (Y = 0); zero when the cursor sits on the pawn. */
+	UPROPERTY(BlueprintReadOnly, Category = "Cursor") FVector AimDir = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Cursor") FVector2D MouseScreen = FVector2D::ZeroVector;
+
+	/** Pawn location in viewport-relative screen space; only meaningful when bPawnOnScreen. */
+	UPROPERTY(BlueprintReadOnly, Category = "Cursor") FVector2D PawnScreen = FVector2D::ZeroVector;
+	UPROPERTY(BlueprintReadOnly, Category = "Cursor") bool bPawnOnScreen = false;
+
+	uint64 Frame = 0;
+};
+
 /**
- * 
+ * Projects the cursor once per frame, before input is processed (PreProcessInput), and publishes it.
+ * Fire / aim input handlers and the possessed pawn (ticks after us) all read this frame's sample.
  */
 UCLASS()
 class BOTTOMLESSPIT_API ACPP_PC_BottomlessPit : public APlayerController
 {
 	GENERATED_BODY()
-	
-};
 
+public:
+	ACPP_PC_BottomlessPit();
+
+	virtual void PreProcessInput(const float DeltaTime, const bool bGamePaused) override;
 
+	UFUNCTION(BlueprintPure, Category = "Cursor")
+	const FCursorSample2D& GetCursorSample() const { return CursorSample; }
 
+protected:
+	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
+
+private:
+	FCursorSample2D CursorSample;
+
+	void UpdateCursorSample();
+};
@@ -31,6 +31,9 @@ public:
 	UFUNCTION(BlueprintCallable) void StartSimpleAI() {}
 	UFUNCTION(BlueprintCallable) void StopSimpleAI() {}
 
+	// Walkers patrol the solid span of the strip they were spawned on (applied right after activation)
+	virtual void BindToStrip(class APlatformStrip* Strip) override;
+
 	// --- Debug (walker/flyer safe) ---
 	UPROPERTY(EditAnywhere, Category = "MinAI|Debug")
 	bool bDebugAI = true;
@@ -38,6 +41,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "MinAI|Debug", meta = (ClampMin = "0.0"))
 	float DebugLineTime = 0.f;
 
+	/** Patrol is stepped by UWS_EnemySim (no actor / movement-component tick). Turn off to get the debug probes drawn. */
+	UPROPERTY(EditAnywhere, Category = "MinAI")
+	bool bUseCentralSim = true;
+
 protected:
 
 	// --- Tunables (mirrors the BT task style) ---
@@ -66,6 +73,9 @@ protected:
 
 
 private:
+	friend class UWS_EnemySim;
+	int32 SimSlot = INDEX_NONE;   // index in UWS_EnemySim arrays while simulated
+
 	// state
 	bool  bAIOn = false;
 	int32 Dir = 1;             // +1 right, -1 left along the chosen lane axis
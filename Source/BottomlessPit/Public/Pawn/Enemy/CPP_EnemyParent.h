@@ -7,6 +7,7 @@
 #include "Engine/EngineTypes.h"
 #include "Components/HealthComponent.h"
 #include "Enum/AIMovementState.h"
+#include "Enum/EnemyTickLOD.h"
 #include "Utility/Util_BpAsyncEnemyAnim.h"
 #include "CPP_EnemyParent.generated.h"
 
@@ -17,7 +18,8 @@ class UPaperZDAnimInstance;
 class UPaperFlipbookComponent;
 class UFloatingPawnMovement;
 class UHealthComponent;
-class UUtil_BpAsyncEnemyAnim;
+class APlatformStrip;
+class UDA_EnemyArchetypeFSM;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAIMoveStateChanged, EAIMovementState, Old, EAIMovementState, New);
 
@@ -111,6 +113,16 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|Anim")
 	TSubclassOf<UPaperZDAnimInstance> BodyAnimInstanceClass;
 
+	/**
+	 * Skip PaperZD: BodyAnim is destroyed after component init and UWS_EnemyFlipbookAnim plays the
+	 * resolved row's flipbooks by AIMoveState (Death included). Leave off for enemies with real anim graphs.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|Anim")
+	bool bUseFlipbookFastPath = false;
+
+	/** Slot in UWS_EnemyFlipbookAnim (INDEX_NONE = not driven there). */
+	int32 FlipbookAnimSlot = INDEX_NONE;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MinAI|Collision")
 	TEnumAsByte<ECollisionChannel> PlayerChannel = ECC_Pawn;     
 
@@ -144,15 +156,70 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool")
 	float MinReuseDelay = 0.25f;
+
+	/**
+	 * Pooled enemies keep their QueryOnly capsule and only swap collision responses (all Ignore),
+	 * stay where they were (hidden, sprite/anim ticks off). Off = legacy NoCollision toggle + far park.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool")
+	bool bKeepBodyWhenPooled = true;
 	float PooledAtTime = -1000.f;
 
-	FTimerHandle Timer_DeferredActivate;
 	FVector PendingActivatePos = FVector::ZeroVector;
 	bool bPendingActivate = false;
 
+	/**
+	 * Activate not before PooledAtTime + MinReuseDelay: through UWS_EnemyActivation (budgeted) when it is
+	 * enabled, otherwise on the spot or from a one-shot timer once the delay has passed.
+	 * Strip: walkers bind to it once active; the activation is dropped if the strip is gone by then.
+	 */
+	void RequestActivateFromPool(const FVector& WorldPos, APlatformStrip* Strip = nullptr);
+
+	/** Called by the queue / reuse timer; false when Ticket is stale (deactivated / re-requested since). */
+	bool ApplyQueuedActivation(uint32 Ticket);
+
+	bool IsPendingActivate() const { return bPendingActivate; }
+
+	/** World Z loop: a queued activation lands where its strip moved to. */
+	void RebasePendingZ(float DeltaZ) { if (bPendingActivate) PendingActivatePos.Z += DeltaZ; }
+
+	/** MinReuseDelay has passed since this enemy was last pooled. */
+	bool IsReuseDelayElapsed() const;
+
+	/** bp.BenchEnemyPool: one Active -> Pooled capsule toggle in the current bKeepBodyWhenPooled mode, no state change. */
+	void BenchmarkCollisionToggle();
+
+	/** Patrol the strip we were spawned on (walkers override). */
+	virtual void BindToStrip(APlatformStrip* Strip) {}
+
+	// Tick LOD (set by UWS_EnemyLOD): tick interval for actor/movement/anim, scale for sensing intervals
+	void ApplyTickLOD(EEnemyTickLOD InLOD, float TickInterval, float SenseScale);
+	EEnemyTickLOD GetTickLOD() const { return TickLOD; }
+
+	/** Ticks ApplyTickLOD throttles that are actually enabled (sim-driven / fast-path pieces don't count). */
+	int32 CountLODTickingComponents() const;
+	float GetAISenseScale() const { return AISenseScale; }
+
+	/**
+	 * Native brain run by UWS_EnemyFSM. When set the enemy gets a plain AAIController (movement input only):
+	 * no behavior tree, blackboard or UEnemyFSMComponent.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AI|FSM")
+	TObjectPtr<UDA_EnemyArchetypeFSM> ArchetypeFSM;
+
+	/** Slot in UWS_EnemyFSM (INDEX_NONE = not running there). */
+	int32 FSMSlot = INDEX_NONE;
+
+	UDataTable* GetAnimationDataTable() const { return AnimationDataTable; }
+	FName GetAnimationRowName() const { return AnimationRowName; }
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+
+	virtual void SpawnDefaultController() override;
+
+	virtual void PostInitializeComponents() override;
 	
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Animations")
 	FName AnimationRowName;
@@ -168,23 +235,27 @@ protected:
 	void ConfigureCollision_Active();
 	void ConfigureCollision_Dying();   
 	void ConfigureCollision_Pooled();
-
-	void ActivateNow_Internal(const FVector& WorldPos);
-	UFUNCTION() void DeferredActivateFromPool();
+	FCollisionResponseContainer MakeActiveResponses() const;
 
 private:
-	/** This UPROPERTY() is crucial to stop the async action from being garbage collected. */
-	UPROPERTY()
-	UUtil_BpAsyncEnemyAnim* AnimLoadAction;
+	/** Shared row cache callback (null = row missing / load failed). */
+	void HandleAnimRowResolved(const FEnemyAnimResolved* Resolved);
 
-	/** C++ function that is called by the async action on success */
-	UFUNCTION()
+	/** C++ function that is called once the shared row resolved */
 	void HandleAnimsLoaded_Internal(FName RowName, const FEnemyAnimResolved& Anim);
 
-	/** C++ function that is called by the async action on failure */
-	UFUNCTION()
+	/** C++ function that is called when the row could not be loaded */
 	void HandleAnimLoadFailed_Internal();
 
+	EEnemyTickLOD TickLOD = EEnemyTickLOD::Near;
+	float AISenseScale = 1.f;
+
+	// activation queue bookkeeping
+	uint32 ActivationTicket = 0;
+	TWeakObjectPtr<APlatformStrip> PendingStrip;
+	bool bPendingHasStrip = false;
+	FTimerHandle ReuseDelayTimer;   // queue disabled: waits out MinReuseDelay
+
 };
 
 
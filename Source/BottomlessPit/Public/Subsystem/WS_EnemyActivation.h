@@ -0,0 +1,134 @@
+﻿// WS_EnemyActivation.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WS_EnemyActivation.generated.h"
+
+class ACPP_EnemyParent;
+class APlatformStrip;
+
+/** Per-frame activation budget; GM pushes this at BeginPlay. */
+USTRUCT(BlueprintType)
+struct FEnemyActivationSettings
+{
+	GENERATED_BODY()
+
+	/** Activations applied per frame at most (the first due one always goes through). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Pool", meta = (ClampMin = "1"))
+	int32 MaxPerFrame = 2;
+
+	/** Stop applying once this much game-thread time was spent this frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Pool", meta = (ClampMin = "0"))
+	float BudgetMs = 0.5f;
+};
+
+/** Queue depth and throughput; wait is from request to applied. */
+USTRUCT(BlueprintType)
+struct FEnemyActivationStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") int32 QueueDepth = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") int32 PeakQueueDepth = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") int32 AppliedLastFrame = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") int32 TotalApplied = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") float AvgWaitMs = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") float LastFrameCostMs = 0.f;
+};
+
+/**
+ * Collision/physics cost of one pool cycle on one enemy, both pooled-state modes.
+ * Only the capsule toggles (ACPP_EnemyParent::BenchmarkCollisionToggle) and the activate / park moves are timed;
+ * hash, LOD, FSM and flipbook registration are the same in both modes and left out.
+ */
+USTRUCT(BlueprintType)
+struct FEnemyPoolBenchResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") int32 Cycles = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") float LegacyUsPerCycle = 0.f;     // NoCollision toggle + far park
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Pool") float KeepBodyUsPerCycle = 0.f;   // response swap, body kept
+};
+
+/**
+ * Pool activations for every enemy, applied in ready-time order under a per-frame budget.
+ * - ACPP_EnemyParent::RequestActivateFromPool enqueues with ReadyTime = pooled time + MinReuseDelay
+ *   (replaces the per-enemy deferral timer); the enemy stays Pooled + pending until applied.
+ * - Deactivating a pending enemy bumps its ticket, so the stale entry is dropped when popped.
+ * - Walkers get their strip binding right after activation, same as the generator did inline.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_EnemyActivation : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_EnemyActivation* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	UFUNCTION(BlueprintCallable, Category = "AI|Pool")
+	void Configure(const FEnemyActivationSettings& InSettings) { Settings = InSettings; }
+
+	/** Off: no per-frame budget; requests apply as soon as the enemy's MinReuseDelay has passed. */
+	UFUNCTION(BlueprintCallable, Category = "AI|Pool")
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	bool IsEnabled() const { return bEnabled; }
+
+	void Enqueue(ACPP_EnemyParent* Enemy, uint32 Ticket, double ReadyTime);
+
+	UFUNCTION(BlueprintPure, Category = "AI|Pool")
+	int32 GetQueueDepth() const { return Queue.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "AI|Pool")
+	FEnemyActivationStats GetStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI|Pool")
+	void LogStats() const;
+
+	/**
+	 * Toggle one pooled enemy's collision Cycles times per mode (bKeepBodyWhenPooled off, then on).
+	 * Both variants are kept as the last result and appended to Saved/Profiling/EnemyPoolBench.csv.
+	 * Console: bp.BenchEnemyPool [Cycles]
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI|Pool")
+	FEnemyPoolBenchResult BenchmarkPoolCycle(int32 Cycles = 200);
+
+	UFUNCTION(BlueprintPure, Category = "AI|Pool")
+	FEnemyPoolBenchResult GetLastPoolBench() const { return LastPoolBench; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPending
+	{
+		TWeakObjectPtr<ACPP_EnemyParent> Enemy;
+		double ReadyTime = 0.0;
+		double RequestTime = 0.0;
+		uint64 Seq = 0;        // FIFO among equal ready times
+		uint32 Ticket = 0;
+
+		bool operator<(const FPending& Other) const
+		{
+			return ReadyTime < Other.ReadyTime || (ReadyTime == Other.ReadyTime && Seq < Other.Seq);
+		}
+	};
+
+	TArray<FPending> Queue;   // binary min-heap on (ReadyTime, Seq)
+	uint64 NextSeq = 0;
+
+	FEnemyActivationSettings Settings;
+	FEnemyActivationStats Stats;
+	FEnemyPoolBenchResult LastPoolBench;
+	bool bEnabled = true;
+
+	void AppendPoolBenchCSV(const FEnemyPoolBenchResult& Result, const FString& EnemyName) const;
+};
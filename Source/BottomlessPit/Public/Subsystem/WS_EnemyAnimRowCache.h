@@ -0,0 +1,74 @@
+﻿// WS_EnemyAnimRowCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Utility/Util_BpAsyncEnemyAnim.h"
+#include "WS_EnemyAnimRowCache.generated.h"
+
+class UDataTable;
+struct FStreamableHandle;
+
+/** Native completion; Resolved is null if the row does not exist or the load failed. */
+DECLARE_DELEGATE_OneParam(FOnEnemyAnimRowResolved, const FEnemyAnimResolved* /*Resolved*/);
+
+/**
+ * One resolved FEnemyAnimResolved per (table, row) for the whole world.
+ * - First request streams the row's sequences; later requests for the same row join that load.
+ * - Entries are immutable once resolved and their sequences stay loaded (handle kept).
+ * - The generator preloads its pool classes' rows and flushes them in WarmEnemyPools,
+ *   so a borrowed enemy already has its anims.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_EnemyAnimRowCache : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_EnemyAnimRowCache* Get(const UObject* WorldContextObject);
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Resolved entry or null (not requested yet / still loading). */
+	const FEnemyAnimResolved* Find(const UDataTable* Table, FName RowName) const;
+
+	/**
+	 * Calls OnDone right away when cached, otherwise once the (possibly shared) load finishes.
+	 * Bind with CreateUObject so a destroyed caller is skipped.
+	 */
+	void Request(UDataTable* Table, FName RowName, FOnEnemyAnimRowResolved OnDone);
+
+	/** Start the load for one row (no callback). */
+	void Preload(UDataTable* Table, FName RowName);
+
+	/** Block until every started load resolved (or TimeoutSeconds passed; 0 = no limit). */
+	void FlushPending(float TimeoutSeconds = 0.f);
+
+	UFUNCTION(BlueprintPure, Category = "Animations|Cache")
+	bool IsRowReady(const UDataTable* Table, FName RowName) const { return Find(Table, RowName) != nullptr; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	using FRowKey = TPair<TObjectKey<UDataTable>, FName>;
+
+	struct FEntry
+	{
+		FEnemyAnimResolved Resolved;
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FOnEnemyAnimRowResolved> Waiters;
+		bool bReady = false;
+	};
+
+	TMap<FRowKey, FEntry> Entries;
+
+	// Hard refs to everything resolved
+	UPROPERTY() TArray<TObjectPtr<UObject>> HeldAssets;
+
+	FEntry* StartLoad(UDataTable* Table, FName RowName);
+	void OnRowLoaded(FRowKey Key, FEnemyAnimRow Row);
+};
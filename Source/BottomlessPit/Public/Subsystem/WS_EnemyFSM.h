@@ -0,0 +1,140 @@
+﻿// WS_EnemyFSM.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Enum/AIMovementState.h"
+#include "AI/BTT/Move2DPawnCache.h"
+#include "WS_EnemyFSM.generated.h"
+
+class ACPP_EnemyParent;
+class APawn;
+class UDA_EnemyArchetypeFSM;
+class UWS_PlatformGraph2D;
+class UWS_Perception2D;
+struct FEnemyFSMTransition;
+
+USTRUCT(BlueprintType)
+struct FEnemyFSMStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|FSM") int32 Agents = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|FSM") int32 SensedLastFrame = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|FSM") int32 TransitionsLastFrame = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|FSM") float LastFrameCostMs = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|FSM") int32 BytesPerAgent = 0;
+};
+
+/**
+ * Native runtime for UDA_EnemyArchetypeFSM brains: one tick for every enemy that has an archetype.
+ * - Per enemy one FAgent (cached components, sense result, state, action scratch); no behavior tree,
+ *   blackboard or UEnemyFSMComponent. The controller is a plain AAIController so movement input still applies.
+ * - Sensing runs per agent at the archetype's interval times the LOD sense scale; LOS goes through UWS_Perception2D.
+ * - Frame: sense when due -> first matching transition of the current state -> step the state's action.
+ * - Enemies join on activation and leave on death / pooling (slot kept on the enemy, swap-remove).
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_EnemyFSM : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_EnemyFSM* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Start running Enemy's ArchetypeFSM from its initial state. */
+	void Add(ACPP_EnemyParent* Enemy);
+	void Remove(ACPP_EnemyParent* Enemy);
+
+	int32 Num() const { return Agents.Num(); }
+
+	/** Current state of Enemy (None when it isn't running here). */
+	UFUNCTION(BlueprintPure, Category = "AI|FSM")
+	FName GetStateName(const ACPP_EnemyParent* Enemy) const;
+
+	UFUNCTION(BlueprintPure, Category = "AI|FSM")
+	FEnemyFSMStats GetStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI|FSM")
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class EActionStatus : uint8 { Running, Succeeded, Failed };
+
+	struct FAgent
+	{
+		const UDA_EnemyArchetypeFSM* Archetype = nullptr;   // held by the enemy's UPROPERTY
+		FMove2DPawnCache Cache;
+
+		int32 State = INDEX_NONE;
+		float StateEnterTime = 0.f;
+		float PhaseTime = 0.f;
+		EActionStatus Status = EActionStatus::Running;
+		uint8 Phase = 0;                                     // 0 = action not started yet
+
+		// sense
+		float NextSenseTime = 0.f;
+		float LastSeenTime = -1000.f;
+		float Dist = 0.f;
+		float TargetDZ = 0.f;
+		bool  bHasTarget = false;
+		bool  bHasLOS = false;
+
+		// action scratch
+		bool  bHasGoal = false;
+		bool  bRequestStrafe = false;                        // set by Fire, consumed by HoldBand
+		FVector Goal = FVector::ZeroVector;
+		float Vz = 0.f;
+		float LastShotTime = -1000.f;
+
+		bool  bRemoved = false;                              // removed mid-Tick, compacted after the pass
+	};
+
+	TArray<FAgent> Agents;
+	FEnemyFSMStats Stats;
+
+	// BP calls during Tick (AI_FireOnce) may kill/pool/spawn enemies: no reallocation or swap while iterating
+	bool bTicking = false;
+	bool bAnyRemoved = false;
+	TArray<TWeakObjectPtr<ACPP_EnemyParent>> DeferredAdds;
+
+	void RemoveAtSwap(int32 Index);
+	void FlushDeferred();
+
+	// valid during Tick only
+	const UWS_PlatformGraph2D* FrameGraph = nullptr;
+	UWS_Perception2D* FramePerception = nullptr;
+	TWeakObjectPtr<APawn> FramePlayer;
+	FVector FramePlayerLoc = FVector::ZeroVector;
+
+	void Sense(FAgent& A, float Now);
+	bool Passes(const FAgent& A, const FEnemyFSMTransition& T, float Now) const;
+	void Enter(FAgent& A, int32 StateIndex, float Now) const;
+	void Step(FAgent& A, float Now, float DeltaTime);
+
+	// actions (BTT_* equivalents)
+	void StepIdle(FAgent& A);
+	void StepPatrol(FAgent& A, float Now);
+	void StepChase(FAgent& A, float Now);
+	void StepHoldBand(FAgent& A);
+	void StepFire(FAgent& A, float Now);
+	void StepReposition(FAgent& A, float Now);
+	void StepJumpUp(FAgent& A, float Now, float DeltaTime);
+
+	// helpers
+	bool MoveTowardX(FAgent& A, float GoalX, float Accept, EAIMovementState Gait) const;
+	void Finish(FAgent& A, bool bSucceeded) const;
+	void Snap(const FAgent& A) const;
+	bool GroundAt(const FAgent& A, const FVector& Start, float Down, FVector& OutGround) const;
+	bool HasLOSFrom(const FAgent& A, const FVector& Eye, const AActor* Target) const;
+	bool PickStrafeGoal(FAgent& A) const;
+};
@@ -0,0 +1,96 @@
+﻿// WS_EnemyFlipbookAnim.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Enum/AIMovementState.h"
+#include "UObject/ObjectKey.h"
+#include "WS_EnemyFlipbookAnim.generated.h"
+
+class ACPP_EnemyParent;
+class UPaperFlipbook;
+class UPaperFlipbookComponent;
+class UPaperZDAnimSequence;
+
+USTRUCT(BlueprintType)
+struct FEnemyFlipbookAnimStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Anim") int32 Enemies = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Anim") int32 FlipbookSets = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Anim") int32 FrameWritesLastFrame = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Anim") int32 SwapsLastFrame = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|Anim") float LastFrameCostMs = 0.f;
+};
+
+/**
+ * Flipbook fast path for enemies with bUseFlipbookFastPath (no PaperZD component / anim instance).
+ * - EAIMovementState picks a flipbook from the enemy's resolved anim row; one set per (table, row), shared by the pool.
+ * - One tick advances every registered enemy; the sprite component itself doesn't tick and is only
+ *   written when the flipbook or the frame index changes.
+ * - Dying enemies play Death once and get Notify_DeathAnimFinished at its end (the PaperZD notify's job).
+ * - Rows whose sequences aren't flipbook-backed leave the set slot empty; the state falls back to Idle.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_EnemyFlipbookAnim : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_EnemyFlipbookAnim* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Drive Enemy's sprite from its ResolvedAnims (no-op until the row has resolved). */
+	void Add(ACPP_EnemyParent* Enemy);
+	void Remove(ACPP_EnemyParent* Enemy);
+
+	/** Flipbook inside a PaperZD flipbook sequence (null for other sequence types). */
+	static UPaperFlipbook* GetSequenceFlipbook(const UPaperZDAnimSequence* Sequence);
+
+	UFUNCTION(BlueprintPure, Category = "AI|Anim")
+	FEnemyFlipbookAnimStats GetStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI|Anim")
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	static constexpr int32 NumMoveStates = int32(EAIMovementState::Jump) + 1;
+
+	struct FFlipbookSet
+	{
+		UPaperFlipbook* ByState[NumMoveStates] = {};
+		UPaperFlipbook* Death = nullptr;
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<ACPP_EnemyParent> Enemy;
+		TWeakObjectPtr<UPaperFlipbookComponent> Sprite;
+		int32 Set = INDEX_NONE;
+		UPaperFlipbook* Current = nullptr;
+		float Time = 0.f;
+		int32 Frame = INDEX_NONE;
+		bool  bDeathNotified = false;
+	};
+
+	TArray<FEntry> Entries;
+	TArray<FFlipbookSet> Sets;
+	TMap<TPair<FObjectKey, FName>, int32> SetByRow;
+
+	/** GC roots for every flipbook referenced by Sets. */
+	UPROPERTY() TArray<TObjectPtr<UPaperFlipbook>> HeldFlipbooks;
+
+	FEnemyFlipbookAnimStats Stats;
+
+	int32 FindOrBuildSet(const ACPP_EnemyParent* Enemy);
+	UPaperFlipbook* Hold(const UPaperZDAnimSequence* Sequence);
+};
@@ -0,0 +1,129 @@
+﻿// WS_EnemyLOD.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Enum/EnemyTickLOD.h"
+#include "WS_EnemyLOD.generated.h"
+
+class ACPP_EnemyParent;
+
+/** Per-bucket rates; GM pushes these at BeginPlay. */
+USTRUCT(BlueprintType)
+struct FEnemyLODSettings
+{
+	GENERATED_BODY()
+
+	/** Extra band around the camera view that still counts as on screen. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "0"))
+	float OnScreenMarginUU = 200.f;
+
+	/** Beyond this many screen heights outside the view, enemies go Far. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "0"))
+	float MidBandScreens = 1.f;
+
+	/** On-screen enemies past this count (furthest from the view center first) drop to Mid. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "1"))
+	int32 MaxNearOnScreen = 16;
+
+	/** Actor / movement / animation tick interval per bucket (0 = every frame). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "0"))
+	float MidTickInterval = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "0"))
+	float FarTickInterval = 0.5f;
+
+	/** Multiplier on BT service intervals and the FSM sense timer. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "1"))
+	float MidSenseScale = 3.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "1"))
+	float FarSenseScale = 10.f;
+
+	/** How often enemies are re-bucketed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "0.02"))
+	float RebucketInterval = 0.2f;
+
+	/** Rough cost of one enemy component tick, only used to turn skipped ticks into a time estimate. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|LOD", meta = (ClampMin = "0"))
+	float AssumedTickCostUs = 6.f;
+};
+
+/**
+ * Bucket counts from the last re-bucket; savings are per second of game time.
+ * TicksSkippedPerSec only counts ticks that are enabled. EstMsSavedPerSec is an estimate
+ * (skipped ticks x AssumedTickCostUs), not a measurement; use stat/Insights for real numbers.
+ */
+USTRUCT(BlueprintType)
+struct FEnemyLODStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI|LOD") int32 Near = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|LOD") int32 Mid = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|LOD") int32 Far = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|LOD") int32 OverBudget = 0;    // on screen but capped to Mid
+	UPROPERTY(BlueprintReadOnly, Category = "AI|LOD") float TicksSkippedPerSec = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "AI|LOD") float EstMsSavedPerSec = 0.f;     // estimate, see above
+};
+
+/**
+ * Significance buckets for active enemies, measured against the player camera's visible band.
+ * - Near: full rate. Mid / Far: actor, movement, flipbook and PaperZD ticks run at an interval,
+ *   BT services (LOS2D, SenseVertical2D) and the FSM sense timer stretch by a scale.
+ * - Enemies register on activation and are restored to full rate when they leave.
+ * - Only bucket changes touch the enemy, so a steady scene costs one distance pass per rebucket.
+ * - Mid / Far enemies get their spatial hash entry refreshed every frame here, since their own tick no longer does.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_EnemyLOD : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_EnemyLOD* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	UFUNCTION(BlueprintCallable, Category = "AI|LOD")
+	void Configure(const FEnemyLODSettings& InSettings);
+
+	/** Off: every registered enemy goes back to full rate and stays there. */
+	UFUNCTION(BlueprintCallable, Category = "AI|LOD")
+	void SetEnabled(bool bInEnabled);
+
+	void Register(ACPP_EnemyParent* Enemy);
+	void Unregister(ACPP_EnemyParent* Enemy);
+
+	UFUNCTION(BlueprintPure, Category = "AI|LOD")
+	FEnemyLODStats GetStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI|LOD")
+	void LogStats() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY() TArray<TObjectPtr<ACPP_EnemyParent>> Enemies;
+
+	FEnemyLODSettings Settings;
+	FEnemyLODStats Stats;
+
+	bool  bEnabled = true;
+	float SinceRebucket = 0.f;
+	float SmoothedFPS = 60.f;
+
+	/** Camera view center and half size (X, Z) on the enemies' plane. False without a camera. */
+	bool GetVisibleBand(FVector2D& OutCenter, FVector2D& OutHalf) const;
+
+	void Rebucket();
+	void RefreshThrottledHash() const;
+	void Apply(ACPP_EnemyParent* Enemy, EEnemyTickLOD LOD) const;
+	float IntervalFor(EEnemyTickLOD LOD) const;
+	float SenseScaleFor(EEnemyTickLOD LOD) const;
+};
@@ -0,0 +1,97 @@
+﻿// WS_EnemySim.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WS_EnemySim.generated.h"
+
+class ACPP_BlpEnemies;
+class APlatformStrip;
+
+/**
+ * One tick for every active ACPP_BlpEnemies (walker / flyer patrol).
+ * - State lives in parallel arrays (index = slot); enemies keep their slot while active, swap-remove on release.
+ * - Frame: gather locations + probe traces (game thread) -> patrol math (ParallelFor above a threshold)
+ *   -> write transforms and spatial-hash updates in one pass.
+ * - Sim-driven enemies have their actor tick and FloatingPawnMovement tick turned off.
+ * - Walkers bound to their spawn strip read ground/edges from the strip's solid span (no traces);
+ *   the span is re-read when the strip reports broken tiles. Their wall check runs against the owning
+ *   generator's collision index (neighbour strips, side walls). Unbound enemies trace as before.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_EnemySim : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_EnemySim* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Start simulating (reads tunables from the enemy once). */
+	void Add(ACPP_BlpEnemies* Enemy);
+	void Remove(ACPP_BlpEnemies* Enemy);
+
+	/** Walk Enemy (a walker already added) within Strip's solid span instead of tracing. */
+	void BindStrip(ACPP_BlpEnemies* Enemy, APlatformStrip* Strip);
+
+	int32 Num() const { return Enemies.Num(); }
+
+	/** Below this many enemies the math step stays on the game thread. */
+	int32 ParallelThreshold = 64;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// ---- per-enemy state (same index everywhere) ----
+	UPROPERTY() TArray<TObjectPtr<ACPP_BlpEnemies>> Enemies;
+
+	// tunables (copied on Add)
+	TArray<uint8>   bIsWalker;
+	TArray<FVector> Axis;
+	TArray<float>   Speed;
+	TArray<float>   HalfHeight;
+	TArray<float>   WallLookAhead;
+	TArray<float>   GroundAhead;
+	TArray<float>   GroundDown;
+	TArray<float>   MinNormalZ;
+	TArray<float>   HoverAmp;
+	TArray<float>   HoverHz;
+	TArray<float>   FlipCooldownSeconds;
+	TArray<TEnumAsByte<ECollisionChannel>> Channel;
+
+	// live state
+	TArray<int32>   Dir;
+	TArray<float>   FlipCooldown;
+	TArray<float>   BaseZ;
+
+	// strip binding (walkers); span is relative to the strip origin so world Z loops carry it
+	struct FStripSpan { float MinDX = 0.f; float MaxDX = 0.f; float TopDZ = 0.f; };
+	TArray<TWeakObjectPtr<APlatformStrip>> Strip;
+	TArray<FStripSpan> Span;
+
+	// per-frame scratch
+	TArray<uint8>   bLive;        // active this frame (dying enemies stay registered but frozen)
+	TArray<FVector> Pos;
+	TArray<float>   GroundZ;      // NaN = no walkable ground under us
+	TArray<uint8>   bGroundAhead;
+	TArray<uint8>   bWall;
+	TArray<float>   Yaw;
+
+	void RemoveAtSwap(int32 Index);
+	void ProbeSerial();
+	void StepMath(int32 i, float Dt, float Now);
+	void ApplySerial();
+
+	bool RefreshSpan(int32 i);
+	void HandleStripSpansChanged(APlatformStrip* ChangedStrip);
+
+	bool TraceWalkable(int32 i, const FVector& At, float& OutZ) const;
+	bool TraceWall(int32 i, const FVector& From) const;
+	bool IndexWall(int32 i, const FVector& From, const APlatformStrip* BoundStrip) const;
+};
@@ -0,0 +1,93 @@
+﻿// WS_FVXPool.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WS_FVXPool.generated.h"
+
+class ACPP_FVX;
+class UDataTable;
+
+/** Per-row counters; Peak is the highest number of effects of that row alive at once. */
+USTRUCT(BlueprintType)
+struct FFVXPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "FVX|Pool") int32 Instances = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "FVX|Pool") int32 Live = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "FVX|Pool") int32 Peak = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "FVX|Pool") int32 Steals = 0;
+};
+
+/**
+ * Native pool of ACPP_FVX, one free list per VFX row name.
+ * - Prewarm spawns N instances for every row of the VFX table (each instance stays on its row).
+ * - Acquire pops the free list; when it is empty the oldest live effect of that row is stopped and reused.
+ * - Instances come back from ACPP_FVX::DeActivateVFX directly (no PoolObjectToGameMode dispatch).
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_FVXPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_FVXPool* Get(const UObject* WorldContextObject);
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category = "FVX|Pool")
+	void Prewarm(TSubclassOf<ACPP_FVX> FVXClass, UDataTable* VFXTable, int32 PerRow = 4);
+
+	/** Idle instance for RowName, or the row's oldest live one (stolen). Null if the row was never prewarmed. */
+	UFUNCTION(BlueprintCallable, Category = "FVX|Pool")
+	ACPP_FVX* Acquire(FName RowName);
+
+	UFUNCTION(BlueprintCallable, Category = "FVX|Pool")
+	void PlayAtLocation(FName RowName, const FVector& WorldLocation);
+
+	UFUNCTION(BlueprintCallable, Category = "FVX|Pool")
+	void PlayWithTransform(FName RowName, const FTransform& WorldTransform);
+
+	UFUNCTION(BlueprintPure, Category = "FVX|Pool")
+	FFVXPoolStats GetRowStats(FName RowName) const;
+
+	/** Log per-row instances / live / peak / steals. */
+	UFUNCTION(BlueprintCallable, Category = "FVX|Pool")
+	void LogStats() const;
+
+	/** Called by ACPP_FVX when its effect finished (or it was stopped). */
+	void Release(ACPP_FVX* FVX);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FRowPool
+	{
+		TArray<TWeakObjectPtr<ACPP_FVX>> Free;
+
+		// Acquire order; entries whose serial no longer matches the actor are stale (lazy removal)
+		TArray<TPair<TWeakObjectPtr<ACPP_FVX>, uint32>> LiveFifo;
+		int32 FifoHead = 0;
+
+		FFVXPoolStats Stats;
+	};
+
+	TMap<FName, FRowPool> Rows;
+
+	// Hard refs for the whole pool
+	UPROPERTY() TArray<TObjectPtr<ACPP_FVX>> Instances;
+
+	UPROPERTY() TSubclassOf<ACPP_FVX> PoolClass;
+	UPROPERTY() TObjectPtr<UDataTable> PoolTable = nullptr;
+
+	uint32 NextSerial = 1;
+
+	ACPP_FVX* SpawnInstance(FName RowName);
+	ACPP_FVX* StealOldest(FRowPool& Pool);
+	void MarkLive(FRowPool& Pool, ACPP_FVX* FVX);
+	void CompactFifo(FRowPool& Pool);
+};
@@ -0,0 +1,95 @@
+﻿// WS_FireModeRegistry.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Utility/Util_BpAsyncFireModeProfile.h"
+#include "WS_FireModeRegistry.generated.h"
+
+class UDataTable;
+class ACPP_ProjectileParent;
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFireModeRegistryReady, int32, NumModes);
+
+/** Free list of prewarmed projectiles for one fire mode. */
+USTRUCT()
+struct FFireModeProjectilePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY() TArray<TObjectPtr<ACPP_ProjectileParent>> Free;
+	UPROPERTY() int32 Spawned = 0;
+};
+
+/**
+ * Every FFireModeRow resolved once, up front.
+ * - One streamable request for all pickup sprites / projectile classes; the handle stays alive so
+ *   the hard refs in the table never unload.
+ * - Pickups then do FindFireMode (a map lookup) instead of a per-pickup async row load.
+ * - Modes whose projectile class is an ACPP_ProjectileParent get a pool (AcquireProjectile). Prewarm is
+ *   opt-in: the gun still spawns through its Blueprint shot events, so a prewarmed pool would sit unused.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_FireModeRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_FireModeRegistry* Get(const UObject* WorldContextObject);
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Resolve every row of Table (async); OnRegistryReady fires once all assets are in. */
+	UFUNCTION(BlueprintCallable, Category = "FireMode|Registry")
+	void BuildFromTable(UDataTable* Table, int32 PrewarmPerMode = 0);
+
+	UFUNCTION(BlueprintPure, Category = "FireMode|Registry")
+	bool IsReady() const { return bReady; }
+
+	const UDataTable* GetSourceTable() const { return SourceTable; }
+
+	/** Hash lookup; false if the registry is not ready or the row does not exist. */
+	UFUNCTION(BlueprintCallable, Category = "FireMode|Registry")
+	bool FindFireMode(FName RowName, FFireModeResolved& OutResolved) const;
+
+	/** Pointer into the table (native callers; stable until the next BuildFromTable). */
+	const FFireModeResolved* FindFireModePtr(FName RowName) const { return Resolved.Find(RowName); }
+
+	/** Inactive projectile for this mode (pooled, or spawned if the pool ran dry). Returns to the pool on OnDeactivated. */
+	UFUNCTION(BlueprintCallable, Category = "FireMode|Registry")
+	ACPP_ProjectileParent* AcquireProjectile(FName RowName, AActor* InOwner);
+
+	UPROPERTY(BlueprintAssignable, Category = "FireMode|Registry")
+	FOnFireModeRegistryReady OnRegistryReady;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY() TObjectPtr<UDataTable> SourceTable = nullptr;
+
+	// Row -> resolved (sprite/class pointers are kept alive by HeldAssets + Handle)
+	TMap<FName, FFireModeResolved> Resolved;
+
+	UPROPERTY() TArray<TObjectPtr<UObject>> HeldAssets;
+
+	UPROPERTY() TMap<FName, FFireModeProjectilePool> Pools;
+
+	// Pooled projectile -> its mode, so OnDeactivated knows where to put it back
+	TMap<TObjectKey<ACPP_ProjectileParent>, FName> PooledMode;
+
+	TSharedPtr<FStreamableHandle> Handle;
+	int32 PendingPrewarm = 0;
+	bool  bReady = false;
+
+	void FinishBuild();
+	void PrewarmPool(FName RowName, int32 Count);
+	ACPP_ProjectileParent* SpawnPooled(FName RowName, UClass* Cls);
+
+	UFUNCTION()
+	void HandleProjectileDeactivated(ACPP_ProjectileParent* Projectile);
+};
@@ -0,0 +1,104 @@
+﻿// WS_ImpactBatch.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WS_ImpactBatch.generated.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+class UTexture2D;
+class UPaperFlipbook;
+class UPaperSprite;
+class UInstancedStaticMeshComponent;
+class UDataTable;
+struct FVFXAnimationResolved;
+
+/**
+ * Short-lived impact flipbooks as instances of one quad mesh per impact type.
+ * - A type is a flipbook laid out as a uniform sprite sheet. Columns/rows come from the first sprite's
+ *   baked UV rect unless given; each key frame's cell is read from its sprite's baked UV rect.
+ * - Per-frame durations are kept: a 1-px-high frame LUT maps every displayed frame (key frames
+ *   repeated FrameRun times) to its atlas cell.
+ * - Spawning writes one ring slot (transform + SpawnTime + tint); the material
+ *   reads LUT[floor((Time - SpawnTime) * FPS)] and clips after FrameCount. No actor, no tick per impact.
+ * - The row's tint is baked into the type and multiplied by the per-spawn tint.
+ * - Render state is flushed once per frame, only for types that were written.
+ *
+ * Quad mesh: centered on its pivot, X = width, Z = height, facing Y.
+ * Per-instance custom data: 0 SpawnTime, 1..4 Tint RGBA.
+ * MID parameters (per type): Atlas, FrameLUT (textures; LUT is R32F, FrameCount x 1, cell index per texel),
+ * Columns, Rows, FrameCount, FPS (scalars).
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_ImpactBatch : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_ImpactBatch* Get(const UObject* WorldContextObject);
+
+	static constexpr int32 NumCustomData = 5;
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Quad + sheet material shared by every type. Call before RegisterType. */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Impact")
+	void Configure(UStaticMesh* QuadMesh, UMaterialInterface* SheetMaterial);
+
+	/**
+	 * Make Flipbook (a sprite sheet) spawnable as TypeName, with Capacity concurrent instances.
+	 * Columns <= 0 derives the sheet width from the baked UV rect; Tint is the type's base color.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Impact")
+	bool RegisterType(FName TypeName, UPaperFlipbook* Flipbook, int32 Columns = 0, int32 Capacity = 128,
+		FLinearColor Tint = FLinearColor::White);
+
+	/** Register VFX table rows as types (row name = type name, row tint = type tint) once the shared row cache resolved them. */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Impact")
+	void RegisterRowsFromTable(UDataTable* VFXTable, const TArray<FName>& RowNames, int32 Columns = 0, int32 Capacity = 128);
+
+	UFUNCTION(BlueprintPure, Category = "VFX|Impact")
+	bool HasType(FName TypeName) const { return Types.Contains(TypeName); }
+
+	/** Play TypeName at WorldTransform (location/rotation; scale multiplies the flipbook size). */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Impact")
+	bool Spawn(FName TypeName, const FTransform& WorldTransform, FLinearColor Tint = FLinearColor::White);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FImpactType
+	{
+		TObjectPtr<UInstancedStaticMeshComponent> Instances = nullptr;
+		FVector2D SizeUU = FVector2D(16.f, 16.f);   // flipbook render size
+		FLinearColor Tint = FLinearColor::White;     // row tint
+		int32 NextSlot = 0;
+		bool  bDirty = false;
+	};
+
+	TMap<FName, FImpactType> Types;
+
+	UPROPERTY() TObjectPtr<AActor> HostActor = nullptr;
+	UPROPERTY() TObjectPtr<UStaticMesh> Quad = nullptr;
+	UPROPERTY() TObjectPtr<UMaterialInterface> BaseMaterial = nullptr;
+
+	// GC roots for the per-type components / MIDs held in Types
+	UPROPERTY() TArray<TObjectPtr<UInstancedStaticMeshComponent>> TypeComponents;
+	UPROPERTY() TArray<TObjectPtr<UMaterialInstanceDynamic>> TypeMaterials;
+	UPROPERTY() TArray<TObjectPtr<UTexture2D>> TypeFrameLUTs;
+
+	static bool BakedUVBounds(const UPaperSprite* Sprite, FBox2D& OutUV);
+	static UTexture2D* BuildFrameLUT(const UPaperFlipbook* Flipbook, int32 Columns, int32 Rows, int32& OutFrames);
+
+	void OnRowResolved(const FVFXAnimationResolved* Resolved, FName RowName, int32 Columns, int32 Capacity);
+
+	FVector2D QuadSizeUU = FVector2D(1.f, 1.f);
+	bool bAnyDirty = false;
+};
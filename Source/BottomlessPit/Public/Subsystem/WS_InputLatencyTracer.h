@@ -0,0 +1,139 @@
+﻿// WS_InputLatencyTracer.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WS_InputLatencyTracer.generated.h"
+
+class APlayerController;
+
+/** What the player pressed; picks the axis the response is looked for on (Move = X, Jump/Down = Z). */
+enum class EInputLatencyKind : uint8
+{
+	Move,
+	Jump,
+	Down,
+	Num
+};
+
+/** Where the response shows up, in pipeline order. */
+enum class EInputLatencyChannel : uint8
+{
+	Velocity,
+	Position,
+	Camera,
+	Num
+};
+
+USTRUCT(BlueprintType)
+struct FInputLatencyStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Debug|Latency") int32 Stamped = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Debug|Latency") int32 Pending = 0;
+	UPROPERTY(BlueprintReadOnly, Category = "Debug|Latency") int32 Dropped = 0;        // pending list full
+	UPROPERTY(BlueprintReadOnly, Category = "Debug|Latency") int32 NoResponse = 0;     // no channel moved within MaxFrames
+};
+
+/**
+ * Instrumentation: how many frames an input event takes to show up in velocity, position and camera.
+ * - The controller stamps Started/Completed input events (Triggered repeats are not stamped).
+ * - Every frame (tickables run after actor ticks and the camera update) the local pawn's velocity,
+ *   location and the camera location are sampled. An event "reaches" a channel the first frame that
+ *   channel leaves its extrapolated pre-input path (value + rate + accel from the last 3 samples)
+ *   by more than the threshold on the event's axis, so gravity or ongoing motion is not a response.
+ * - Results go into per kind x channel histograms (frames 0..MaxFrames, plus a "never" bucket) and are
+ *   written as CSV to Saved/Profiling on dump and when the world goes away (headless scripted runs).
+ * Off by default; -InputLatency on the command line or console: bp.InputLatency [0|1], bp.InputLatencyDump [File]
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_InputLatencyTracer : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_InputLatencyTracer* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	UFUNCTION(BlueprintCallable, Category = "Debug|Latency")
+	void SetEnabled(bool bInEnabled);
+
+	bool IsEnabled() const { return bEnabled; }
+
+	/** Call from input handlers; no-op when disabled. */
+	void Stamp(EInputLatencyKind Kind, APlayerController* PC);
+
+	/** Clear histograms (keeps the enabled state). */
+	UFUNCTION(BlueprintCallable, Category = "Debug|Latency")
+	void ResetHistograms();
+
+	/** Write the histograms as CSV; empty FileName = Saved/Profiling/InputLatency_<time>.csv. */
+	UFUNCTION(BlueprintCallable, Category = "Debug|Latency")
+	bool ExportCSV(const FString& FileName = TEXT(""));
+
+	UFUNCTION(BlueprintPure, Category = "Debug|Latency")
+	FInputLatencyStats GetStats() const { return Stats; }
+
+	UFUNCTION(BlueprintCallable, Category = "Debug|Latency")
+	void LogStats() const;
+
+	/** Frames after the stamp before an event with no response is given up on. */
+	int32 MaxFrames = 30;
+
+	// deviation from the extrapolated path that counts as a response
+	float VelocityThreshold = 5.f;     // uu/s
+	float PositionThreshold = 0.05f;   // uu
+	float CameraThreshold = 0.05f;     // uu
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	static constexpr int32 NumKinds = (int32)EInputLatencyKind::Num;
+	static constexpr int32 NumChannels = (int32)EInputLatencyChannel::Num;
+	static constexpr int32 MaxPending = 64;
+
+	struct FSample
+	{
+		double Time = 0.0;
+		FVector Value[NumChannels];
+	};
+
+	struct FEvent
+	{
+		EInputLatencyKind Kind = EInputLatencyKind::Move;
+		uint64 Frame = 0;
+		double RealTime = 0.0;
+		double BaseTime = 0.0;
+		FVector Base[NumChannels];
+		FVector Rate[NumChannels];
+		FVector Accel[NumChannels];
+		uint8 DoneMask = 0;
+	};
+
+	// last three end-of-frame samples of the traced controller, newest first
+	FSample History[3];
+	int32 NumHistory = 0;
+	TWeakObjectPtr<APlayerController> TracedPC;
+
+	TArray<FEvent> Events;
+
+	// [Kind][Channel] -> count per frame delay; last bucket = never reached
+	TArray<int32> Histogram[NumKinds][NumChannels];
+	double SumMs[NumKinds][NumChannels] = {};
+	int32 NumHits[NumKinds][NumChannels] = {};
+
+	FInputLatencyStats Stats;
+	bool bEnabled = false;
+
+	bool Sample(FSample& Out) const;
+	void Record(const FEvent& E, int32 Channel, int32 Frames, double Ms);
+	bool HasSamples() const;
+};
@@ -0,0 +1,108 @@
+﻿// WS_Perception2D.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "WS_Perception2D.generated.h"
+
+class APawn;
+
+/**
+ * Player perception shared by every enemy, refreshed once per frame.
+ * - Player pawn, location and velocity are read once per frame; services and the FSM use the cached copy.
+ * - LOS to the player is cached per (observer, channel, eye height), so callers with different trace
+ *   settings never overwrite each other. Asking queues the entry; all queued entries go out as one batch
+ *   of async line traces per frame and the results are harvested on the next tick.
+ * - A result is at most one ask-interval old (observers are re-traced only after they asked again),
+ *   so cost follows the consumers' service rates, not the enemy count.
+ * - Distance is always computed fresh from the cached player location.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_Perception2D : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_Perception2D* Get(const UObject* WorldContextObject);
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	UFUNCTION(BlueprintPure, Category = "AI|Perception")
+	APawn* GetPlayerPawn() const { return Player.Get(); }
+
+	UFUNCTION(BlueprintPure, Category = "AI|Perception")
+	FVector GetPlayerLocation() const { return PlayerLocation; }
+
+	UFUNCTION(BlueprintPure, Category = "AI|Perception")
+	FVector GetPlayerVelocity() const { return PlayerVelocity; }
+
+	/**
+	 * Cached 2D (XZ) LOS from Observer's eye to the player. Returns false while there is no result yet
+	 * (first ask, or no player); OutDist is valid whenever there is a player.
+	 * Each distinct channel/eye height gets its own entry; asks sharing one keep the widest range.
+	 */
+	bool QueryPlayerLOS(const AActor* Observer, float EyeHeight, float Range, ECollisionChannel Channel,
+		bool& bOutHasLOS, float& OutDist);
+
+	/** Traces sent in the last batch. */
+	int32 GetLastBatchSize() const { return LastBatchSize; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FLOSEntry
+	{
+		TWeakObjectPtr<const AActor> Observer;
+		float EyeHeight = 0.f;
+		float Range = 0.f;
+		TEnumAsByte<ECollisionChannel> Channel = ECC_Visibility;
+
+		FTraceHandle Pending;
+		uint64 SentFrame = 0;
+		float LastAskTime = 0.f;
+		bool  bAsked = false;      // asked since the last trace went out
+		bool  bHasResult = false;
+		bool  bHasLOS = false;
+	};
+
+	struct FLOSKey
+	{
+		TObjectKey<AActor> Observer;
+		int32 EyeHeight = 0;   // whole units; sub-unit differences share a trace
+		TEnumAsByte<ECollisionChannel> Channel = ECC_Visibility;
+
+		bool operator==(const FLOSKey& O) const
+		{
+			return Observer == O.Observer && EyeHeight == O.EyeHeight && Channel == O.Channel;
+		}
+		friend uint32 GetTypeHash(const FLOSKey& K)
+		{
+			return HashCombine(GetTypeHash(K.Observer), HashCombine(::GetTypeHash(K.EyeHeight), ::GetTypeHash((uint8)K.Channel)));
+		}
+	};
+
+	TMap<FLOSKey, FLOSEntry> Entries;
+
+	TWeakObjectPtr<APawn> Player;
+	FVector PlayerLocation = FVector::ZeroVector;
+	FVector PlayerVelocity = FVector::ZeroVector;
+
+	int32 LastBatchSize = 0;
+
+	/** Observers nobody asked about for this long are dropped. */
+	float ForgetAfterSeconds = 5.f;
+
+	void RefreshPlayer();
+	void HarvestResults();
+	void SendBatch();
+
+	static float Dist2D(const FVector& A, const FVector& B);
+};
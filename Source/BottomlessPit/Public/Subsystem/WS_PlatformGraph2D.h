@@ -0,0 +1,148 @@
+﻿// WS_PlatformGraph2D.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "WS_PlatformGraph2D.generated.h"
+
+class APlatformStrip;
+
+/** How an enemy gets from one span to another. */
+UENUM(BlueprintType)
+enum class EPlatformLink2D : uint8
+{
+	Walk,   // same height, touching
+	Drop,   // lower, walk off the edge
+	Jump    // higher, or same height across a gap
+};
+
+/** Enemy movement limits the links are built under. */
+USTRUCT(BlueprintType)
+struct FPlatformGraphLimits
+{
+	GENERATED_BODY()
+
+	// tops closer than this count as the same height
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph", meta = (ClampMin = "0"))
+	float StepToleranceUU = 8.f;
+
+	// horizontal gap still walkable (touching strips)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph", meta = (ClampMin = "0"))
+	float WalkGapUU = 4.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph", meta = (ClampMin = "0"))
+	float MaxJumpUpUU = 260.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph", meta = (ClampMin = "0"))
+	float MaxJumpGapUU = 240.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph", meta = (ClampMin = "0"))
+	float MaxDropUU = 900.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Graph", meta = (ClampMin = "0"))
+	float MaxDropGapUU = 160.f;
+};
+
+/** One solid span (node) in world space. */
+USTRUCT(BlueprintType)
+struct FPlatformSpan2D
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Graph") float MinX = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Graph") float MaxX = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Graph") float TopZ = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Graph") float BottomZ = 0.f;
+	UPROPERTY(BlueprintReadOnly, Category = "Graph") float Y = 0.f;
+	TWeakObjectPtr<APlatformStrip> Strip;
+};
+
+/**
+ * Standable spans of the live strips plus walk / drop / jump links between them.
+ * - The generator adds a strip when it spawns it and removes it in DespawnRow; a broken tile
+ *   re-splits that strip's spans (APlatformStrip::OnSpansChanged) and relinks only them.
+ * - Z-loop: RebaseZ shifts every node; links don't change.
+ * - BT tasks ask it for ground / same-floor / headroom / jump takeoff instead of tracing.
+ *   An empty graph (no generator) means "unknown": callers keep their trace path.
+ * - Node ids are only valid until the next Add/Remove; don't store them across frames.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_PlatformGraph2D : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_PlatformGraph2D* Get(const UObject* WorldContextObject);
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Limits apply to links built afterwards; set before the first row spawns. */
+	void Configure(const FPlatformGraphLimits& InLimits) { Limits = InLimits; }
+	const FPlatformGraphLimits& GetLimits() const { return Limits; }
+
+	// ---------- Build ----------
+
+	void AddStrip(APlatformStrip* Strip);
+	void RemoveStrip(APlatformStrip* Strip);
+	void RebaseZ(float DeltaZ);
+
+	int32 Num() const { return NumLive; }
+	bool HasData() const { return NumLive > 0; }
+
+	// ---------- Queries (game plane) ----------
+
+	/** Highest span under At.X with top in [At.Z - MaxDown, At.Z]; INDEX_NONE if none. */
+	int32 FindSpanBelow(const FVector& At, float MaxDown) const;
+
+	/** FindSpanBelow as a ground point (At.X, At.Y, top) - same shape as a trace impact. */
+	bool GroundBelow(const FVector& At, float MaxDown, FVector& OutGround) const;
+
+	bool GetSpan(int32 Node, FPlatformSpan2D& OutSpan) const;
+
+	/** Node plus everything reachable from it over Walk links. */
+	void GetWalkConnected(int32 Node, TArray<int32>& OutNodes) const;
+
+	/** No span body overlaps the column [X +- HalfWidth] x [FromZ, FromZ + Height]. */
+	bool IsHeadroomClear(float X, float HalfWidth, float FromZ, float Height) const;
+
+	/**
+	 * Best Jump link out of Node rising at most MaxRise that a straight-up jump lands on
+	 * (spans overlap in X; takeoff nearest PreferX). Returns the landing node; INDEX_NONE if none.
+	 */
+	int32 FindJumpUp(int32 Node, float PreferX, float MaxRise, float& OutTakeoffX) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FLink
+	{
+		int32 To = INDEX_NONE;
+		EPlatformLink2D Kind = EPlatformLink2D::Walk;
+	};
+
+	struct FNode
+	{
+		FPlatformSpan2D Span;
+		TArray<FLink> Links;         // outgoing
+		TArray<int32> LinkedFrom;    // nodes holding a link to us (for removal)
+		bool bLive = false;
+	};
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+	TMap<TObjectKey<APlatformStrip>, TArray<int32>> StripNodes;
+	int32 NumLive = 0;
+
+	FPlatformGraphLimits Limits;
+
+	int32 AddNode(APlatformStrip* Strip, const FBox& Box);
+	void RemoveNode(int32 Node);
+	void LinkNode(int32 Node);
+	bool Classify(const FPlatformSpan2D& From, const FPlatformSpan2D& To, EPlatformLink2D& OutKind) const;
+
+	void HandleStripSpansChanged(APlatformStrip* Strip);
+};
@@ -0,0 +1,131 @@
+﻿// WS_SpatialHash2D.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "WS_SpatialHash2D.generated.h"
+
+/** What an entry is; queries filter with a bit mask of these (see UWS_SpatialHash2D::KindBit). */
+UENUM(BlueprintType)
+enum class ESpatialKind2D : uint8
+{
+	Enemy,
+	Player,
+	Projectile,
+	Strip
+};
+
+/** One segment-query result, ordered near-to-far. */
+USTRUCT(BlueprintType)
+struct FSpatialHit2D
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Spatial")
+	TObjectPtr<AActor> Actor = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Spatial")
+	ESpatialKind2D Kind = ESpatialKind2D::Enemy;
+
+	// 0..1 along the segment
+	UPROPERTY(BlueprintReadOnly, Category = "Spatial")
+	float Time = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Spatial")
+	FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * Uniform 2D grid over the game plane (world X / Z) for "what is near this point" questions.
+ * - Enemies, player, projectiles and strips register from their own activate/deactivate paths.
+ * - Movers call UpdateActor from their move step; only a cell change touches the buckets.
+ * - Z-loop: RebaseZ shifts entries and the grid origin together, so nothing is rehashed.
+ * - No physics: boxes are the registered bounds on the plane.
+ * - Each kind registers in exactly one place (enemies: ActivateFromPool; projectiles: ArmAndGo;
+ *   player: BeginPlay; strips: generator SpawnRuns).
+ * - Consumers: projectile indexed steps (ACPP_ProjectileParent::AnyPawnAlong) skip their pawn sweep
+ *   when no enemy/player box lies along the step.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_SpatialHash2D : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_SpatialHash2D* Get(const UObject* WorldContextObject);
+
+	static constexpr uint8 KindBit(ESpatialKind2D Kind) { return uint8(1u << uint8(Kind)); }
+	static constexpr uint8 AllKinds = 0xFF;
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Cell edge in UU. Change before anything registers. */
+	float CellSizeUU = 128.f;
+
+	// ---------- Registration ----------
+
+	/** Register (or refresh) using the root primitive's bounds on the plane. */
+	void Register(AActor* Actor, ESpatialKind2D Kind);
+
+	/** Register (or refresh) with an explicit world box (strips: the collider, not the actor pivot). */
+	void RegisterBox(AActor* Actor, ESpatialKind2D Kind, const FBox& WorldBox);
+
+	void Unregister(AActor* Actor);
+
+	/** Re-read the actor location; cheap when it stays in the same cells. */
+	void UpdateActor(const AActor* Actor);
+
+	/** Everything in the well moved by DeltaZ (generator Z-loop). */
+	void RebaseZ(float DeltaZ);
+
+	// ---------- Queries (game plane; Y is ignored) ----------
+
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	int32 QueryPoint(const FVector& Point, TArray<AActor*>& OutActors, uint8 KindMask = 0xFF) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	int32 QueryRadius(const FVector& Center, float Radius, TArray<AActor*>& OutActors, uint8 KindMask = 0xFF) const;
+
+	/** Swept circle (Radius may be 0) from Start to End; hits sorted by Time. */
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	int32 QuerySegment(const FVector& Start, const FVector& End, float Radius, TArray<FSpatialHit2D>& OutHits, uint8 KindMask = 0xFF) const;
+
+	int32 GetNumEntries() const { return Lookup.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		ESpatialKind2D Kind = ESpatialKind2D::Enemy;
+		FVector2D Center = FVector2D::ZeroVector;   // (X, Z)
+		FVector2D Half = FVector2D::ZeroVector;
+		FVector2D Offset = FVector2D::ZeroVector;   // box center - actor location
+		FIntPoint CellMin = FIntPoint::ZeroValue;
+		FIntPoint CellMax = FIntPoint::ZeroValue;
+		mutable uint32 QueryStamp = 0;
+		bool bLive = false;
+	};
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TMap<TObjectKey<AActor>, int32> Lookup;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	float OriginZ = 0.f;
+	mutable uint32 QueryCounter = 0;
+
+	FIntPoint CellOf(double X, double Z) const;
+	void Insert(AActor* Actor, ESpatialKind2D Kind, const FVector2D& Center, const FVector2D& Half, const FVector2D& Offset);
+	void LinkCells(int32 Index);
+	void UnlinkCells(int32 Index);
+	uint32 NextStamp() const;
+
+	template <typename FuncType>
+	void ForEachCandidate(const FVector2D& Min, const FVector2D& Max, uint8 KindMask, FuncType&& Func) const;
+};
@@ -0,0 +1,64 @@
+﻿// WS_TrailBatch.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WS_TrailBatch.generated.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+class UInstancedStaticMeshComponent;
+
+/**
+ * Every bullet tracer in the world as one instanced quad mesh.
+ * - Fixed ring of instances; a new tracer overwrites the oldest slot (no add/remove churn).
+ * - Fade lives in the material: (Time - SpawnTime) / Life from per-instance custom data,
+ *   so a tracer costs one slot write and nothing afterwards (no timer, no MID, no actor wake).
+ * - Render state is flushed once per frame, only on frames that wrote a slot.
+ *
+ * Quad mesh: spans local X [0, 1] from its pivot (start point), width along Z, facing Y.
+ * Per-instance custom data (PerInstanceCustomData[0..6]):
+ *   0 Tiling   1 Thickness   2 DashFill   3 HeadTaper   4 SpawnTime   5 Life   6 UseDashes
+ * SpawnTime is world game time, the same clock as the material Time node.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_TrailBatch : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_TrailBatch* Get(const UObject* WorldContextObject);
+
+	static constexpr int32 NumCustomData = 7;
+
+	// UTickableWorldSubsystem
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Create the instanced renderer. Capacity = max tracers visible at once. */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Trail")
+	void Configure(UStaticMesh* QuadMesh, UMaterialInterface* TrailMaterial, int32 Capacity = 256);
+
+	UFUNCTION(BlueprintPure, Category = "VFX|Trail")
+	bool IsConfigured() const { return Instances != nullptr; }
+
+	/** Add one tracer segment (X/Z plane). Returns false if not configured or degenerate. */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Trail")
+	bool AddTrail(const FVector& From, const FVector& To, float Thickness = 1.f, float DashFill = 0.9f,
+		float HeadTaper = 0.2f, float Life = 0.06f, float TileWorldUU = 16.f, bool bUseDashes = true);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY() TObjectPtr<AActor> HostActor = nullptr;
+	UPROPERTY() TObjectPtr<UInstancedStaticMeshComponent> Instances = nullptr;
+
+	// unscaled local length of the quad (from mesh bounds)
+	float QuadLengthUU = 1.f;
+
+	int32 NextSlot = 0;
+	bool  bRenderDirty = false;
+};
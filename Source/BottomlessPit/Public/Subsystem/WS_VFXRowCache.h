@@ -0,0 +1,71 @@
+﻿// WS_VFXRowCache.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Utility/Util_BpAsyncVFXFlipbooks.h"
+#include "WS_VFXRowCache.generated.h"
+
+class UDataTable;
+struct FStreamableHandle;
+
+/** Native completion; Resolved is null if the row does not exist or the load failed. */
+DECLARE_DELEGATE_OneParam(FOnVFXRowResolved, const FVFXAnimationResolved* /*Resolved*/);
+
+/**
+ * One resolved FVFXAnimationResolved per (table, row) for the whole world.
+ * - First request streams the row's flipbooks; later requests for the same row join that load.
+ * - Entries are immutable once resolved and their flipbooks stay loaded (handle kept).
+ * - Every ACPP_FVX reads from here, so pooled instances play a row immediately after anyone loaded it.
+ */
+UCLASS()
+class BOTTOMLESSPIT_API UWS_VFXRowCache : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWS_VFXRowCache* Get(const UObject* WorldContextObject);
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Resolved entry or null (not requested yet / still loading). */
+	const FVFXAnimationResolved* Find(const UDataTable* Table, FName RowName) const;
+
+	/**
+	 * Calls OnDone right away when cached, otherwise once the (possibly shared) load finishes.
+	 * Bind with CreateUObject so a destroyed caller is skipped.
+	 */
+	void Request(UDataTable* Table, FName RowName, FOnVFXRowResolved OnDone);
+
+	/** Start loads for every row of Table (no callbacks). */
+	UFUNCTION(BlueprintCallable, Category = "VFX|Cache")
+	void PreloadTable(UDataTable* Table);
+
+	UFUNCTION(BlueprintPure, Category = "VFX|Cache")
+	bool IsRowReady(const UDataTable* Table, FName RowName) const { return Find(Table, RowName) != nullptr; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	using FRowKey = TPair<TObjectKey<UDataTable>, FName>;
+
+	struct FEntry
+	{
+		FVFXAnimationResolved Resolved;
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FOnVFXRowResolved> Waiters;
+		bool bReady = false;
+	};
+
+	TMap<FRowKey, FEntry> Entries;
+
+	// Hard refs to everything resolved
+	UPROPERTY() TArray<TObjectPtr<UObject>> HeldAssets;
+
+	FEntry* StartLoad(UDataTable* Table, FName RowName);
+	void OnRowLoaded(FRowKey Key, FVFXAnimationRow Row);
+};
@@ -9,6 +9,7 @@
 
 class UDataTable;
 class UPaperSprite;
+class UPaperFlipbook;
 struct FStreamableHandle;
 
 /* -----------------------  INLINE TYPES (no separate header)  ----------------------- */
@@ -116,6 +117,42 @@ struct FFireModeResolved
 	FFireModeProfile Profile;
 };
 
+/** Everything a projectile needs to arm, precomputed by the gun (no lookups on the projectile side). */
+USTRUCT(BlueprintType)
+struct FProjectileLaunch
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	FVector Direction = FVector(0.f, 0.f, -1.f);
+
+	// <= 0 keeps the projectile's own Stats value
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	float Speed = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	float LifeSeconds = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	float Damage = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	float Scale = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	bool bPenetrate = false;
+
+	// nullptr keeps the projectile's current flipbook
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	UPaperFlipbook* SpawnFlipbook = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	UPaperFlipbook* LoopFlipbook = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FireMode|Launch")
+	UPaperFlipbook* ImpactFlipbook = nullptr;
+};
+
 /* -----------------------  ASYNC NODE  ----------------------- */
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFireModeAsyncCompleted, FName, RowName, const FFireModeResolved&, Resolved);